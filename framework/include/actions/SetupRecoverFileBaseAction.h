@@ -57,10 +57,30 @@ private:
   void getCheckpointFiles(std::set<std::string> & files);
 
   /**
-   * Extract the file base to utilize for recovery, uses the newest of the files in the supplied set
+   * Extract the file base to utilize for recovery, uses the newest complete checkpoint of the files in the supplied set
    * @param The most current checkpoing file base
    */
   std::string getRecoveryFileBase(const std::set<std::string> checkpoint_files);
+
+  /**
+   * Whether the restartable data files of every processor and thread exist for a checkpoint
+   * and none of them is still being written
+   * @param base The file base of the checkpoint
+   * @param n_procs The number of processors the checkpoint should have been written with
+   * @param n_threads The number of threads the checkpoint should have been written with
+   */
+  bool restartableDataComplete(const std::string & base, processor_id_type n_procs, unsigned int n_threads);
+
+  /**
+   * The number of processors and threads a checkpoint was written with, deduced from the names of its
+   * restartable data files
+   * @param base The file base of the checkpoint
+   * @param checkpoint_files All of the checkpoint files
+   * @param n_procs The number of processors (output)
+   * @param n_threads The number of threads (output)
+   */
+  void writtenCounts(const std::string & base, const std::set<std::string> & checkpoint_files,
+                     processor_id_type & n_procs, unsigned int & n_threads);
 };
 
 #endif //SETUPRECOVERFILEBASEACTION_H
@@ -72,6 +72,9 @@ protected:
 
   /// Additional factor added to the solution, the b of ax+b
   const Real _add_factor;
+
+  /// The element of the solution that contained the previous node, tried first for the next one
+  const Elem * _elem_hint;
 };
 
 #endif //SOLUTIONAUX_H
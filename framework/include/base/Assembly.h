@@ -315,6 +315,14 @@ public:
    */
   void useFECache(bool fe_cache) { _should_use_fe_cache = fe_cache; }
 
+  /**
+   * Whether or not this assembly should build the volume shape functions of elements with an
+   * affine map from per element type reference data instead of reinitializing the FE objects.
+   *
+   * @param affine_fe_cache True for using the cache false for not.
+   */
+  void useAffineFECache(bool affine_fe_cache) { _should_use_affine_fe_cache = affine_fe_cache; }
+
   void prepare();
 
   /**
@@ -448,6 +456,15 @@ public:
    */
   void setCachedNodalBCJacobianEntries(SparseMatrix<Number> & jacobian);
 
+  /**
+   * Replaces the rows of y that belong to the previously-cached NodalBC
+   * Jacobian entries by the product of those rows with x.  This is the
+   * matrix-free counterpart of setCachedNodalBCJacobianEntries().
+   * @param x Ghosted vector the Jacobian is applied to
+   * @param y Closed result vector
+   */
+  void applyCachedNodalBCJacobianEntries(const NumericVector<Number> & x, NumericVector<Number> & y);
+
 protected:
   /**
    * Just an internal helper function to reinit the volume FE objects.
@@ -456,6 +473,17 @@ protected:
    */
   void reinitFE(const Elem * elem);
 
+  /**
+   * Reinit the volume shape functions, q_points and JxW of an element with an affine map from the
+   * reference data of its element type and the constant Jacobian of the map.  FE types whose shape
+   * functions depend on more than the reference coordinates (or need second derivatives) are
+   * reinitialized as usual.
+   *
+   * @param elem The element we are using to reinit
+   * @return false if the element is not affine, in which case nothing was done
+   */
+  bool reinitFEAffine(const Elem * elem);
+
   /**
    * Just an internal helper function to reinit the face FE objects.
    *
@@ -672,6 +700,31 @@ protected:
   /// Whether or not fe should currently be cached - This will be false if something funky is going on with the quadrature rules.
   bool _currently_fe_caching;
 
+  /**
+   * Reference data of an FE type on an affine element: phi is the same on every element and the
+   * gradients only have to be mapped with the constant inverse Jacobian.
+   */
+  class AffineFEShapeData
+  {
+  public:
+    std::vector<std::vector<Real> > _phi;
+    /// Gradients with respect to the reference coordinates
+    std::vector<std::vector<RealGradient> > _ref_grad_phi;
+  };
+
+  /// Whether or not the affine element cache should be used
+  bool _should_use_affine_fe_cache;
+
+  /// Reference data for affine elements by element type and quadrature rule
+  std::map<std::pair<ElemType, const QBase *>, std::map<FEType, AffineFEShapeData> > _affine_fe_shape_data;
+
+  ///@{
+  /// Storage the affine reinit points the shape data at
+  std::map<FEType, std::vector<std::vector<RealGradient> > > _affine_grad_phi;
+  std::vector<Point> _affine_q_points;
+  std::vector<Real> _affine_JxW;
+  ///@}
+
   // Shape function values, gradients. second derivatives for each FE type
   std::map<FEType, FEShapeData * > _fe_shape_data;
   std::map<FEType, FEShapeData * > _fe_shape_data_face;
@@ -0,0 +1,166 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef ASSEMBLYTIMINGS_H
+#define ASSEMBLYTIMINGS_H
+
+#include "MooseTypes.h"
+#include "ParallelUniqueId.h"
+
+// libMesh includes
+#include "libmesh/parallel.h"
+
+// System includes
+#include <map>
+#include <ostream>
+
+class MooseObject;
+
+/**
+ * Accumulates timing information for a threaded assembly loop: the number of elements
+ * and the wall time spent by each thread as well as the time spent in every subdomain
+ * and in every kernel.  Each thread only ever writes into its own slot so recording
+ * does not require any locking.  All times are cumulative until reset() is called.
+ *
+ * A loop records into this object with startLoop() and endLoop() around its pass over
+ * the elements and with startElement() and endElement() around every element.  The
+ * summaries that combine the data of all processors are collective.
+ */
+class AssemblyTimings
+{
+public:
+  AssemblyTimings();
+
+  /**
+   * Turn the recording on or off.  Enabling clears any old data.
+   */
+  void enable(bool enable = true);
+
+  /**
+   * Whether or not timings are being recorded
+   */
+  bool enabled() const { return _enabled; }
+
+  /**
+   * Clear all of the recorded data and size the storage for the current number of threads
+   */
+  void reset();
+
+  /**
+   * The current wall clock time in seconds
+   */
+  static Real wallTime();
+
+  /**
+   * Count one execution of the threaded loop (called once per loop, outside of the threads)
+   */
+  void addLoop() { if (_enabled) _num_loops++; }
+
+  /**
+   * The number of times the loop was executed
+   */
+  unsigned int numLoops() const { return _num_loops; }
+
+  /**
+   * Start and end the pass of thread tid over its part of the elements
+   */
+  void startLoop(THREAD_ID tid);
+  void endLoop(THREAD_ID tid);
+
+  /**
+   * Start and end the work of thread tid on an element of the given subdomain
+   */
+  void startElement(THREAD_ID tid) { _elem_start[tid] = wallTime(); }
+  void endElement(THREAD_ID tid, SubdomainID subdomain);
+
+  /**
+   * Record time spent by thread tid in the given kernel (or other object)
+   */
+  void addObjectTime(THREAD_ID tid, const MooseObject * object, Real time) { _object_time[tid][object] += time; }
+
+  /**
+   * The number of threads data is stored for
+   */
+  unsigned int numThreads() const { return _thread_elems.size(); }
+
+  /**
+   * The number of elements visited by thread tid
+   */
+  unsigned long int threadElements(THREAD_ID tid) const { return _thread_elems[tid]; }
+
+  /**
+   * The wall time spent in the loop by thread tid
+   */
+  Real threadTime(THREAD_ID tid) const { return _thread_time[tid]; }
+
+  /**
+   * Gather the element counts and times of every thread on every processor (collective)
+   * @param processor Filled with the processor id of each entry
+   * @param thread Filled with the thread id of each entry
+   * @param elements Filled with the number of elements visited by each thread
+   * @param time Filled with the wall time spent in the loop by each thread
+   */
+  void gatherThreadData(const Parallel::Communicator & comm, std::vector<Real> & processor, std::vector<Real> & thread,
+                        std::vector<Real> & elements, std::vector<Real> & time) const;
+
+  /**
+   * Sum the element counts and times of each subdomain over the threads and processors (collective)
+   * @param subdomain Filled with the ids of the subdomains any processor visited
+   * @param elements Filled with the number of elements visited in each subdomain
+   * @param time Filled with the time spent on the elements of each subdomain
+   */
+  void sumSubdomainData(const Parallel::Communicator & comm, std::vector<Real> & subdomain,
+                        std::vector<Real> & elements, std::vector<Real> & time) const;
+
+  /**
+   * Sum the time spent in the given objects over the threads and processors (collective).
+   * Objects are per thread so they are identified by name; the names must be given in the
+   * same order on every processor.
+   */
+  void sumObjectTimes(const Parallel::Communicator & comm, const std::vector<std::string> & names, std::vector<Real> & time) const;
+
+  /**
+   * Print a human readable summary of the data of all processors (collective)
+   * @param title What the loop is, e.g. "Residual"
+   * @param object_names The names of the objects to report times for, in the same order on every processor
+   */
+  void printSummary(std::ostream & os, const Parallel::Communicator & comm, const std::string & title,
+                    const std::vector<std::string> & object_names) const;
+
+protected:
+  bool _enabled;
+
+  /// The number of loop executions
+  unsigned int _num_loops;
+
+  /// Per thread element counts
+  std::vector<unsigned long int> _thread_elems;
+
+  /// Per thread wall time
+  std::vector<Real> _thread_time;
+
+  /// Per thread start of the current pass and element
+  std::vector<Real> _loop_start;
+  std::vector<Real> _elem_start;
+
+  /// Per thread time spent on and number of elements visited in each subdomain
+  std::vector<std::map<SubdomainID, Real> > _subdomain_time;
+  std::vector<std::map<SubdomainID, unsigned long int> > _subdomain_elems;
+
+  /// Per thread time spent in each object.  Objects are per thread so they are merged by name.
+  std::vector<std::map<const MooseObject *, Real> > _object_time;
+};
+
+#endif // ASSEMBLYTIMINGS_H
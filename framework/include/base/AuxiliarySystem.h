@@ -95,6 +95,20 @@ public:
    */
   virtual void compute(ExecFlagType type);
 
+  /**
+   * Compute the scalar and nodal auxiliary variables only. This is used when the elemental
+   * variables are computed in the same element loop as the residual (see FEProblem), after
+   * which finishElementalVars() must be called.
+   * @param type Time flag of which variables should be computed
+   */
+  void computeNonElementalVars(ExecFlagType type);
+
+  /**
+   * Assemble the solution after the elemental variables were computed outside of compute()
+   * and update their time derivatives
+   */
+  void finishElementalVars();
+
   /**
    * Get a list of dependent UserObjects for this exec type
    * @param type Execution flag type
@@ -102,6 +116,12 @@ public:
    */
   std::set<std::string> getDependObjects(ExecFlagType type);
 
+  /**
+   * Get the AuxKernel warehouses (one per thread) for an execution flag
+   * @param type Execution flag type
+   */
+  std::vector<AuxWarehouse> & getAuxWarehouses(ExecFlagType type) { return _auxs(type); }
+
   /**
    * Adds a solution length vector to the system.
    *
@@ -154,6 +174,7 @@ protected:
   friend class ComputeNodalAuxVarsThread;
   friend class ComputeNodalAuxBcsThread;
   friend class ComputeElemAuxVarsThread;
+  friend class ComputeFusedResidualThread;
   friend class ComputeElemAuxBcsThread;
   friend class ComputeIndicatorThread;
   friend class ComputeMarkerThread;
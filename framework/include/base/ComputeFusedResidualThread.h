@@ -0,0 +1,57 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef COMPUTEFUSEDRESIDUALTHREAD_H
+#define COMPUTEFUSEDRESIDUALTHREAD_H
+
+#include "ComputeResidualThread.h"
+#include "AuxWarehouse.h"
+#include "UserObjectWarehouse.h"
+
+class AuxiliarySystem;
+
+/**
+ * Residual loop that also computes the elemental AuxKernels and executes the ElementUserObjects
+ * that would otherwise need their own pass over the mesh, sharing a single reinit (of the
+ * variables and materials) per element. FEProblem decides what can be fused, see
+ * FEProblem::fuseElementalAux() and FEProblem::fuseElementUserObjects().
+ */
+class ComputeFusedResidualThread : public ComputeResidualThread
+{
+public:
+  ComputeFusedResidualThread(FEProblem & fe_problem, NonlinearSystem & sys, Moose::KernelType type);
+  // Splitting Constructor
+  ComputeFusedResidualThread(ComputeFusedResidualThread & x, Threads::split split);
+
+  virtual ~ComputeFusedResidualThread();
+
+  virtual void subdomainChanged();
+  virtual void onElement(const Elem *elem);
+
+protected:
+  virtual void addSubdomainDependencies(std::set<MooseVariable *> & needed_moose_vars, std::set<std::string> & needed_mat_props);
+
+  AuxiliarySystem & _aux_sys;
+
+  /// The elemental AuxKernels to compute, NULL if they are not fused
+  std::vector<AuxWarehouse> * _auxs;
+
+  /// The ElementUserObjects to execute, NULL if they are not fused
+  std::vector<UserObjectWarehouse> * _user_objects;
+
+  /// The group of user objects that is fused (the ones executed after the AuxKernels)
+  UserObjectWarehouse::GROUP _group;
+};
+
+#endif //COMPUTEFUSEDRESIDUALTHREAD_H
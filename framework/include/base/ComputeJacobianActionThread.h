@@ -0,0 +1,79 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef COMPUTEJACOBIANACTIONTHREAD_H
+#define COMPUTEJACOBIANACTIONTHREAD_H
+
+#include "ComputeJacobianThread.h"
+
+// libMesh includes
+#include "libmesh/dense_vector.h"
+
+/**
+ * Applies the Jacobian to a vector (y += J x) element by element without assembling it.
+ *
+ * The local Jacobian blocks are computed by the Kernels, IntegratedBCs and DGKernels
+ * exactly like ComputeFullJacobianThread does, but every (ivar, jvar) block is contracted
+ * with the local entries of x as soon as it has been computed instead of being added to a
+ * sparse matrix.  All of the variable couplings the objects declare are used, independently
+ * of the coupling of the preconditioning matrix, so the action is the one of the full Jacobian.
+ */
+class ComputeJacobianActionThread : public ComputeJacobianThread
+{
+public:
+  /**
+   * @param x The ghosted vector to apply the Jacobian to
+   * @param y The vector the result is added to
+   * @param jacobian The system matrix, only needed to satisfy the base class; it is never touched
+   */
+  ComputeJacobianActionThread(FEProblem & fe_problem, NonlinearSystem & sys, const NumericVector<Number> & x,
+                              NumericVector<Number> & y, SparseMatrix<Number> & jacobian);
+
+  // Splitting Constructor
+  ComputeJacobianActionThread(ComputeJacobianActionThread & x, Threads::split split);
+
+  virtual ~ComputeJacobianActionThread();
+
+  virtual void onInternalSide(const Elem *elem, unsigned int side);
+  virtual void postElement(const Elem * /*elem*/);
+  virtual void post();
+
+  void join(const ComputeJacobianActionThread & /*y*/) {}
+
+protected:
+  virtual void computeJacobian();
+  virtual void computeFaceJacobian(BoundaryID bnd_id);
+  virtual void computeInternalFaceJacobian();
+
+  /**
+   * Contract a local Jacobian block with x and cache the result for y
+   */
+  void applyBlock(DenseMatrix<Number> & block, const std::vector<dof_id_type> & idof_indices,
+                  const std::vector<dof_id_type> & jdof_indices, Real scaling_factor);
+
+  const NumericVector<Number> & _x;
+  NumericVector<Number> & _y;
+
+  /// Contributions to y, added in one go at the end of the loop
+  std::vector<Number> _cached_values;
+  std::vector<dof_id_type> _cached_rows;
+
+  /// Scratch space for the contractions
+  std::vector<dof_id_type> _idofs;
+  std::vector<dof_id_type> _jdofs;
+  DenseVector<Number> _local_x;
+  DenseVector<Number> _local_y;
+};
+
+#endif //COMPUTEJACOBIANACTIONTHREAD_H
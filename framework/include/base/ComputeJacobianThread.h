@@ -21,6 +21,7 @@
 
 class FEProblem;
 class NonlinearSystem;
+class AssemblyTimings;
 
 class ComputeJacobianThread : public ThreadedElementLoop<ConstElemRange>
 {
@@ -32,6 +33,7 @@ public:
 
   virtual ~ComputeJacobianThread();
 
+  virtual void pre();
   virtual void subdomainChanged();
   virtual void onElement(const Elem *elem);
   virtual void onBoundary(const Elem *elem, unsigned int side, BoundaryID bnd_id);
@@ -47,6 +49,9 @@ protected:
 
   unsigned int _num_cached;
 
+  /// Where timings are recorded to, NULL if timing is disabled
+  AssemblyTimings * _timings;
+
   virtual void computeJacobian();
   virtual void computeFaceJacobian(BoundaryID bnd_id);
   virtual void computeInternalFaceJacobian();
@@ -0,0 +1,45 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef COMPUTERESIDUALANDJACOBIANTHREAD_H
+#define COMPUTERESIDUALANDJACOBIANTHREAD_H
+
+#include "ComputeFullJacobianThread.h"
+
+class FEProblem;
+class NonlinearSystem;
+
+/**
+ * Assembles the residual and the Jacobian in a single pass over the elements, so the
+ * element reinit, the variable evaluation and the materials are only done once.
+ */
+class ComputeResidualAndJacobianThread : public ComputeFullJacobianThread
+{
+public:
+  ComputeResidualAndJacobianThread(FEProblem & fe_problem, NonlinearSystem & sys, SparseMatrix<Number> & jacobian);
+
+  // Splitting Constructor
+  ComputeResidualAndJacobianThread(ComputeResidualAndJacobianThread & x, Threads::split split);
+
+  virtual ~ComputeResidualAndJacobianThread();
+
+  virtual void onElement(const Elem *elem);
+  virtual void onBoundary(const Elem *elem, unsigned int side, BoundaryID bnd_id);
+  virtual void onInternalSide(const Elem *elem, unsigned int side);
+  virtual void postElement(const Elem * /*elem*/);
+
+  void join(const ComputeResidualAndJacobianThread & /*y*/);
+};
+
+#endif //COMPUTERESIDUALANDJACOBIANTHREAD_H
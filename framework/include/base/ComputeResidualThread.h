@@ -22,6 +22,8 @@
 
 class FEProblem;
 class NonlinearSystem;
+class AssemblyTimings;
+class MooseVariable;
 
 
 class ComputeResidualThread : public ThreadedElementLoop<ConstElemRange>
@@ -33,6 +35,7 @@ public:
 
   virtual ~ComputeResidualThread();
 
+  virtual void pre();
   virtual void subdomainChanged();
   virtual void onElement(const Elem *elem );
   virtual void onBoundary(const Elem *elem, unsigned int side, BoundaryID bnd_id);
@@ -43,9 +46,21 @@ public:
   void join(const ComputeResidualThread & /*y*/);
 
 protected:
+  /**
+   * Add the variables and material properties needed by objects other than the residual
+   * objects that are computed in this loop. Called from subdomainChanged().
+   */
+  virtual void addSubdomainDependencies(std::set<MooseVariable *> & /*needed_moose_vars*/, std::set<std::string> & /*needed_mat_props*/) {}
+
+  /// Compute the residual contributions of the active kernels on the current element
+  void computeKernelResiduals();
+
   NonlinearSystem & _sys;
   Moose::KernelType _kernel_type;
   unsigned int _num_cached;
+
+  /// Where timings are recorded to, NULL if timing is disabled
+  AssemblyTimings * _timings;
 };
 
 #endif //COMPUTERESIDUALTHREAD_H
@@ -148,11 +148,22 @@ public:
    */
   virtual std::set<dof_id_type> & ghostedElems() { return _mproblem.ghostedElems(); }
 
+  /**
+   * Return the list of nodes that should have their DoFs ghosted to this processor.
+   * @return The list
+   */
+  virtual std::set<dof_id_type> & ghostedNodes() { return _mproblem.ghostedNodes(); }
+
   /**
    * Will make sure that all dofs connected to elem_id are ghosted to this processor
    */
   virtual void addGhostedElem(dof_id_type elem_id);
 
+  /**
+   * Will make sure that all dofs on node_id are ghosted to this processor
+   */
+  virtual void addGhostedNode(dof_id_type node_id);
+
   /**
    * Will make sure that all necessary elements from boundary_id are ghosted to this processor
    * @param boundary_id Boundary ID
@@ -216,6 +216,24 @@ public:
    */
   virtual void clearActiveElementalMooseVariables(THREAD_ID tid);
 
+  /**
+   * Record the material properties needed by the objects active in the current loop. Only the
+   * volume materials supplying these (and the materials they depend on) are computed by
+   * reinitMaterials() until clearActiveMaterialProperties() is called.
+   *
+   * @param mat_prop_names The names of the material properties needed
+   * @param tid The thread id
+   */
+  virtual void setActiveMaterialProperties(const std::set<std::string> & mat_prop_names, THREAD_ID tid);
+
+  /**
+   * Clear the active material properties. If there are no active material properties then all
+   * of the materials are computed.
+   *
+   * @param tid The thread id
+   */
+  virtual void clearActiveMaterialProperties(THREAD_ID tid);
+
   virtual void createQRules(QuadratureType type, Order order, Order volume_order=INVALID_ORDER, Order face_order=INVALID_ORDER);
 
   /**
@@ -246,6 +264,7 @@ public:
   virtual void prepareAssembly(THREAD_ID tid);
 
   virtual void addGhostedElem(dof_id_type elem_id);
+  virtual void addGhostedNode(dof_id_type node_id);
   virtual void addGhostedBoundary(BoundaryID boundary_id);
   virtual void ghostGhostedBoundaries();
 
@@ -277,6 +296,14 @@ public:
    */
   virtual void useFECache(bool fe_cache);
 
+  /**
+   * Whether or not this problem should build the shape functions of affine elements from
+   * per element type reference data.
+   *
+   * @param affine_fe_cache True for using the cache false for not.
+   */
+  virtual void useAffineFECache(bool affine_fe_cache);
+
   virtual void init();
   virtual void solve();
 
@@ -879,6 +906,24 @@ public:
   /// Returns whether or not this Problem has a TimeIntegrator
   bool hasTimeIntegrator() const { return _has_time_integrator; }
 
+  ///@{
+  /**
+   * Whether the elemental AuxKernels and the ElementUserObjects executed on 'linear' are computed
+   * in the residual element loop (see the "fuse_residual_loops" parameter)
+   */
+  bool fuseElementalAux() const { return _fuse_elemental_aux; }
+  bool fuseElementUserObjects() const { return _fuse_element_uos; }
+  ///@}
+
+  /// Whether the next residual element loop has to compute the fused AuxKernels and user objects
+  bool fusedResidualLoopPending() const { return _fused_loop_pending; }
+
+  /**
+   * Assemble the aux solution and finalize the user objects after the fused residual
+   * element loop
+   */
+  void finishFusedResidualLoop();
+
 protected:
   MooseMesh & _mesh;
   EquationSystems _eq;
@@ -971,6 +1016,32 @@ protected:
 
   void computeUserObjectsInternal(ExecFlagType type, UserObjectWarehouse::GROUP group);
 
+  /// Join the element user objects across the threads, finalize them and store postprocessor values
+  void finalizeElementUserObjects(std::vector<UserObjectWarehouse> & pps, UserObjectWarehouse::GROUP group);
+
+  /**
+   * Decide which of the elemental AuxKernels and ElementUserObjects executed on 'linear' can be
+   * computed in the residual element loop. This is only the case if none of the objects computed
+   * in that loop (kernels, boundary conditions, DG kernels, materials and functions) consume
+   * their results.
+   */
+  void buildFusedResidualPlan();
+
+  /**
+   * Decide whether the residual and the Jacobian can be assembled together (see the
+   * "residual_and_jacobian_together" parameter). This requires NEWTON without a line search
+   * or a finite differenced or physics based preconditioner, and nothing that computeJacobian()
+   * would execute on 'nonlinear'.
+   */
+  void buildCombinedResidualJacobianPlan();
+
+  /**
+   * Whether the Jacobian assembled together with the last residual is the one requested
+   * @param soln The solution the Jacobian is requested at
+   * @param jacobian The matrix the Jacobian is requested in
+   */
+  bool combinedJacobianCurrent(const NumericVector<Number> & soln, SparseMatrix<Number> & jacobian);
+
   void checkUserObjects();
 
   /// Verify that there are no element type/coordinate type conflicts
@@ -1056,6 +1127,25 @@ private:
   bool _error_on_jacobian_nonzero_reallocation;
   bool _fail_next_linear_convergence_check;
 
+  /// Whether the user asked for the aux and user object loops to be fused with the residual loop
+  bool _fuse_residual_loops;
+  /// What is fused (see buildFusedResidualPlan())
+  bool _fuse_elemental_aux;
+  bool _fuse_element_uos;
+  /// Set while a fused residual element loop is outstanding
+  bool _fused_loop_pending;
+
+  /// Whether the user asked for the residual and the Jacobian to be assembled together
+  bool _residual_and_jacobian_together;
+  /// Whether they are (see buildCombinedResidualJacobianPlan())
+  bool _combine_residual_jacobian;
+  /// Set while the solver's residual evaluation is running if it assembles the Jacobian as well
+  bool _assemble_jacobian_with_residual;
+  /// Whether the system matrix holds the Jacobian at _combined_jacobian_solution
+  bool _combined_jacobian_valid;
+  /// The solution the last combined evaluation was done at
+  NumericVector<Number> * _combined_jacobian_solution;
+
   friend class AuxiliarySystem;
   friend class NonlinearSystem;
   friend class EigenSystem;
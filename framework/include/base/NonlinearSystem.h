@@ -25,6 +25,7 @@
 #include "SplitWarehouse.h"
 #include "TimeIntegrator.h"
 #include "Predictor.h"
+#include "AssemblyTimings.h"
 
 // libMesh includes
 #include "libmesh/transient_system.h"
@@ -74,6 +75,7 @@ public:
   virtual void timestepSetup();
 
   void setupFiniteDifferencedPreconditioner();
+  void setupMatrixFreeJacobian();
   void setupDecomposition();
   void setupSplitBasedPreconditioner();
 
@@ -202,6 +204,15 @@ public:
    */
   void computeResidual(NumericVector<Number> & residual, Moose::KernelType type = Moose::KT_ALL);
 
+  /**
+   * Computes the residual and the Jacobian at the same solution, assembling both in a single
+   * element loop
+   * @param residual Residual is formed in here
+   * @param jacobian Jacobian is formed in here
+   * @return true if both were assembled, false if the evaluation was aborted
+   */
+  bool computeResidualAndJacobian(NumericVector<Number> & residual, SparseMatrix<Number> & jacobian);
+
   /**
    * Finds the implicit sparsity graph between geometrically related dofs.
    */
@@ -291,6 +302,11 @@ public:
    */
   void setPreconditioner(MooseSharedPointer<MoosePreconditioner> pc);
 
+  /**
+   * The preconditioner set with setPreconditioner(), NULL if there is none
+   */
+  MoosePreconditioner * getPreconditioner() { return _preconditioner.get(); }
+
   /**
    * If called with true this system will use a finite differenced form of
    * the Jacobian as the preconditioner
@@ -323,6 +339,37 @@ public:
    */
   void assembleConstraintsSeparately(bool separately=true) {_assemble_constraints_separately = separately;}
 
+  /**
+   * If called with true the threaded residual and Jacobian loops keep every element contribution in
+   * their thread-local Assembly cache and the caches are added into the global vector/matrix in a
+   * single serial pass once the loop has joined.  No shared lock is taken inside the element loop,
+   * at the cost of holding one thread's worth of cached entries in memory.
+   */
+  void deferCachedAssembly(bool defer=true) { _defer_cached_assembly = defer; }
+
+  /**
+   * Whether or not cached element contributions are held until the threaded loop has joined
+   */
+  bool deferCachedAssembly() const { return _defer_cached_assembly; }
+
+  /**
+   * Per-thread, per-subdomain and per-kernel timings of the residual assembly loop
+   * (only recorded once enabled).
+   */
+  AssemblyTimings & residualTimings() { return _residual_timings; }
+
+  /**
+   * Per-thread, per-subdomain and per-kernel timings of the Jacobian assembly loops, including
+   * the combined residual and Jacobian loop and the matrix-free Jacobian action
+   * (only recorded once enabled).
+   */
+  AssemblyTimings & jacobianTimings() { return _jacobian_timings; }
+
+  /**
+   * The names of the kernels, in the same order on every processor (used to report per-kernel timings)
+   */
+  std::vector<std::string> kernelNames() const;
+
   /**
    * Setup damping stuff (called before we actually start)
    */
@@ -360,6 +407,13 @@ public:
    */
   unsigned int nResidualEvaluations() { return _n_residual_evaluations; }
 
+  /**
+   * Return the total number of Jacobian evaluations done so far in this calculation.  The
+   * Jacobians assembled together with a residual (see computeResidualAndJacobian()) are
+   * not counted.
+   */
+  unsigned int nJacobianEvaluations() { return _n_jacobian_evaluations; }
+
   /**
    * Return the final nonlinear residual
    */
@@ -462,8 +516,33 @@ protected:
    */
   void computeNodalBCs(NumericVector<Number> & residual);
 
+  /**
+   * Closes the residual after the residual objects have been computed and applies the nodal BCs
+   * @param residual The residual being formed
+   */
+  void finishResidual(NumericVector<Number> & residual);
+
+  /**
+   * Sets the matrix options and calls jacobianSetup() on the objects before assembly
+   * @param jacobian The matrix that is about to be assembled
+   */
+  void prepareJacobianAssembly(SparseMatrix<Number> & jacobian);
+
   void computeJacobianInternal(SparseMatrix<Number> &  jacobian);
 
+public:
+  /**
+   * Applies the Jacobian at the current solution to a vector without assembling it.
+   * Used as the operator of the solve when solve_type = MATRIX_FREE.  The nodal BC rows
+   * are taken from the entries cached by the last computeJacobian() call, which is the
+   * assembly of the preconditioning matrix for the current Newton step.
+   * @param x The vector to apply the Jacobian to
+   * @param y The result J x
+   */
+  void computeJacobianAction(const NumericVector<Number> & x, NumericVector<Number> & y);
+
+protected:
+
   void computeDiracContributions(SparseMatrix<Number> * jacobian = NULL);
 
   void computeScalarKernelsJacobians(SparseMatrix<Number> & jacobian);
@@ -529,7 +608,13 @@ protected:
   bool _use_finite_differenced_preconditioner;
 #ifdef LIBMESH_HAVE_PETSC
   MatFDColoring _fdcoloring;
+
+  /// Shell matrix applying the Jacobian for solve_type = MATRIX_FREE
+  Mat _mf_jacobian;
 #endif
+  /// Ghosted copy of the vector the matrix-free Jacobian is applied to
+  NumericVector<Number> * _mf_x;
+
   /// Whether or not the system can be decomposed into splits
   bool _have_decomposition;
   /// Name of the top-level split of the decomposition
@@ -543,6 +628,15 @@ protected:
   /// Whether or not to assemble the residual and Jacobian after the application of each constraint.
   bool _assemble_constraints_separately;
 
+  /// Whether or not cached residual and Jacobian entries are only added once the threaded loops have joined
+  bool _defer_cached_assembly;
+
+  /// Timings of the threaded residual loops
+  AssemblyTimings _residual_timings;
+
+  /// Timings of the threaded Jacobian loops
+  AssemblyTimings _jacobian_timings;
+
   /// Whether or not a copy of the residual needs to be made
   bool _need_serialized_solution;
 
@@ -565,6 +659,12 @@ protected:
   /// Total number of residual evaluations that have been performed
   unsigned int _n_residual_evaluations;
 
+  /// Total number of Jacobian evaluations that have been performed
+  unsigned int _n_jacobian_evaluations;
+
+  /// The Jacobian assembled together with the residual, NULL outside of computeResidualAndJacobian()
+  SparseMatrix<Number> * _combined_jacobian;
+
   Real _final_residual;
 
   /// If predictor is active, this is non-NULL
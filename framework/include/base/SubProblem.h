@@ -236,6 +236,13 @@ public:
    */
   virtual void addGhostedElem(dof_id_type elem_id) = 0;
 
+  /**
+   * Will make sure that all dofs on node_id are ghosted to this processor.  Objects that need a
+   * handful of off-processor values should use this (or addGhostedElem()) instead of requesting
+   * a fully serialized solution.
+   */
+  virtual void addGhostedNode(dof_id_type node_id) = 0;
+
   /**
    * Will make sure that all necessary elements from boundary_id are ghosted to this processor
    */
@@ -278,6 +285,12 @@ public:
    */
   virtual std::set<dof_id_type> & ghostedElems() { return _ghosted_elems; }
 
+  /**
+   * Return the list of nodes that should have their DoFs ghosted to this processor.
+   * @return The list
+   */
+  virtual std::set<dof_id_type> & ghostedNodes() { return _ghosted_nodes; }
+
   /**
    * Register a piece of restartable data.  This is data that will get
    * written / read to / from a restart file.
@@ -336,6 +349,9 @@ protected:
   /// Elements that should have Dofs ghosted to the local processor
   std::set<dof_id_type> _ghosted_elems;
 
+  /// Nodes that should have Dofs ghosted to the local processor
+  std::set<dof_id_type> _ghosted_nodes;
+
   /// Storage for RZ axis selection
   unsigned int _rz_coord_axis;
 
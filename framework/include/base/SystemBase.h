@@ -138,7 +138,10 @@ public:
   virtual NumericVector<Number> & getVector(std::string name) = 0;
 
   /**
-   * Returns a reference to a serialized version of the solution vector for this subproblem
+   * Returns a reference to a serialized version of the solution vector for this subproblem.
+   * Calling this makes every subsequent solution update gather the whole vector onto every
+   * processor; objects that only need a few off-processor values should ghost them with
+   * SubProblem::addGhostedElem() or SubProblem::addGhostedNode() and read currentSolution().
    */
   virtual NumericVector<Number> & serializedSolution() = 0;
 
@@ -140,6 +140,10 @@ ThreadedElementLoopBase<RangeType>::operator () (const RangeType & range, bool b
     pre();
 
     _subdomain = std::numeric_limits<SubdomainID>::max();
+
+    // Reused for every side so that looking up the boundary ids does not allocate
+    std::vector<BoundaryID> boundary_ids;
+
     typename RangeType::const_iterator el = range.begin();
     for (el = range.begin() ; el != range.end(); ++el)
     {
@@ -159,11 +163,10 @@ ThreadedElementLoopBase<RangeType>::operator () (const RangeType & range, bool b
 
       for (unsigned int side=0; side<elem->n_sides(); side++)
       {
-        std::vector<BoundaryID> boundary_ids = _mesh.boundaryIDs(elem, side);
+        _mesh.boundaryIDs(elem, side, boundary_ids);
 
-        if (boundary_ids.size() > 0)
-          for (std::vector<BoundaryID>::iterator it = boundary_ids.begin(); it != boundary_ids.end(); ++it)
-            onBoundary(elem, side, *it);
+        for (std::vector<BoundaryID>::iterator it = boundary_ids.begin(); it != boundary_ids.end(); ++it)
+          onBoundary(elem, side, *it);
 
         if (elem->neighbor(side) != NULL)
           onInternalSide(elem, side);
@@ -69,6 +69,15 @@ public:
    */
   virtual Real value(Real t, const Point & p);
 
+  /**
+   * Evaluate the scalar function at several points at once (e.g. all of the qps of an element).
+   * By default this calls value() for each point, override it if the function can do better.
+   * \param t The time
+   * \param pts The points in space (x,y,z)
+   * \param values Filled with the value of the function at each point
+   */
+  virtual void values(Real t, const std::vector<Point> & pts, std::vector<Real> & values);
+
   /**
    * Override this to evaluate the vector function at a point (t,x,y,z), by default
    * this returns a zero vector, you must override it.
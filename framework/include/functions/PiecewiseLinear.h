@@ -36,6 +36,14 @@ public:
    */
   virtual Real value(Real t, const Point & pt);
 
+  /**
+   * Get the value of the function at several points at once (e.g. all of the qps of an element)
+   * \param t The time
+   * \param pts The points in space (x,y,z)
+   * \param values Filled with the value of the function at each point
+   */
+  virtual void values(Real t, const std::vector<Point> & pts, std::vector<Real> & values);
+
   /**
    * Get the time derivative of the function (based on time only)
    * \param t The time
@@ -48,6 +56,12 @@ public:
 
   virtual Real average();
 
+protected:
+  /**
+   * The interval of the last lookup, see LinearInterpolation::sample().  Every thread has
+   * its own copy of the function, so this does not need to be shared.
+   */
+  unsigned int _interval;
 };
 
 template<>
@@ -50,6 +50,13 @@ public:
    */
   virtual Real value(Real t, const Point & p);
 
+  /** Extract the values at several points at once, see SolutionUserObject::pointValues()
+   * @param t Time at which to extract
+   * @param pts Spatial locations of desired data
+   * @param values Filled with the value at each point
+   */
+  virtual void values(Real t, const std::vector<Point> & pts, std::vector<Real> & values);
+
   // virtual RealGradient gradient(Real t, const Point & p);
 
   /** Setup the function for use
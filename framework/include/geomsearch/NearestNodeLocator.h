@@ -30,6 +30,7 @@
 
 class MooseMesh;
 class SubProblem;
+class KDTree;
 
 /**
  * Finds the nearest node to each node in boundary1 to each node in boundary2 and the other way around.
@@ -52,6 +53,13 @@ public:
    */
   void reinit();
 
+  /**
+   * Rebuild the slave node patches because nodes have moved.
+   * Unlike reinit() this reuses the spatial tree over the master nodes
+   * as long as they have only moved a small distance since it was built.
+   */
+  void updatePatch();
+
   /**
    * Valid to call this after findNodes() has been called to get the distance to the nearest node.
    */
@@ -86,12 +94,33 @@ public:
   };
 
 protected:
+  /**
+   * Make sure _kd_tree covers the current trial master nodes. Returns an upper bound on how
+   * far any of them has moved since the tree was built (zero for a freshly built tree).
+   */
+  Real updateKDTree(const std::vector<dof_id_type> & trial_master_nodes);
+
+  /// Clear all data computed by findNodes()
+  void clearPatches();
+
   SubProblem & _subproblem;
 
   MooseMesh & _mesh;
 
   NodeIdRange * _slave_node_range;
 
+  /// Spatial tree over the trial master nodes used to build the patches
+  KDTree * _kd_tree;
+
+  /// The trial master nodes the tree was built over
+  std::vector<dof_id_type> _kd_tree_master_nodes;
+
+  /// Smallest patch radius found with the current tree, used to decide when the tree must be rebuilt
+  Real _kd_tree_patch_radius;
+
+  /// Whether the next patch construction may reuse the existing tree
+  bool _reuse_kd_tree;
+
 public:
   std::map<dof_id_type, NearestNodeInfo> _nearest_node_info;
 
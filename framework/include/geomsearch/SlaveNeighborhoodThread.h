@@ -22,11 +22,19 @@
 // System
 #include <set>
 
+class KDTree;
+
 class SlaveNeighborhoodThread
 {
 public:
+  /**
+   * @param kd_tree Tree over the positions of the trial master nodes (same ordering as trial_master_nodes)
+   * @param max_displacement Upper bound on how far any master node has moved since kd_tree was built
+   */
   SlaveNeighborhoodThread(const MooseMesh & mesh,
                           const std::vector<dof_id_type> & trial_master_nodes,
+                          const KDTree & kd_tree,
+                          Real max_displacement,
                           std::map<dof_id_type, std::vector<dof_id_type> > & node_to_elem_map,
                           const unsigned int patch_size);
 
@@ -47,6 +55,9 @@ public:
   /// Elements that we need to ghost
   std::set<dof_id_type> _ghosted_elems;
 
+  /// The smallest distance from a slave node to the furthest node in its patch
+  Real _min_patch_radius;
+
 protected:
   /// The Mesh
   const MooseMesh & _mesh;
@@ -54,6 +65,12 @@ protected:
   /// Nodes to search against
   const std::vector<dof_id_type> & _trial_master_nodes;
 
+  /// Spatial tree over the trial master nodes
+  const KDTree & _kd_tree;
+
+  /// How far the master nodes may have moved since the tree was built
+  Real _max_displacement;
+
   /// Node to elem map
   std::map<dof_id_type, std::vector<dof_id_type> > & _node_to_elem_map;
 
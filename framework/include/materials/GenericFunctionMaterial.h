@@ -37,6 +37,9 @@ class GenericFunctionMaterial : public Material
 public:
   GenericFunctionMaterial(const InputParameters & parameters);
 
+  /// Evaluates each function at all of the qps with one Function::values() call
+  virtual void computeProperties();
+
 protected:
   virtual void initQpStatefulProperties();
   virtual void computeQpProperties();
@@ -60,6 +63,12 @@ private:
 
   /// Flag for calling declareProperyOld/Older
   bool _enable_stateful;
+
+  /// The qps of the current element, handed to Function::values()
+  std::vector<Point> _points;
+
+  /// The function values at _points
+  std::vector<Real> _values;
 };
 
 #endif //GENERICFUNCTIONMATERIAL_H
@@ -156,6 +156,12 @@ public:
 
   void checkStatefulSanity() const;
 
+  /**
+   * Whether or not this Material declared any stateful (old or older) properties. Such materials
+   * have to be computed on every element so that their history stays current.
+   */
+  bool hasStatefulProperties() const { return _has_stateful_property; }
+
   /**
    * Check if a material property is valid for all blocks of this Material
    *
@@ -16,6 +16,7 @@
 #define MATERIALPROPERTYINTERFACE_H
 
 #include <map>
+#include <set>
 #include <string>
 
 // MOOSE includes
@@ -148,6 +149,13 @@ public:
    */
   bool getMaterialPropertyCalled() const { return _get_material_property_called; }
 
+  /**
+   * Retrieve the set of material properties that _this_ object depends on.
+   *
+   * @return The names of the material properties this object depends on
+   */
+  const std::set<std::string> & getMatPropDependencies() const { return _material_property_dependencies; }
+
 protected:
 
   /// The name of the object that this interface belongs to
@@ -196,6 +204,9 @@ protected:
    */
   bool _get_material_property_called;
 
+  /// The set of material properties (as given by their names) that _this_ object depends on
+  std::set<std::string> _material_property_dependencies;
+
   /// Storage vector for MaterialProperty<Real> default objects
   std::vector<MooseSharedPointer<MaterialProperty<Real> > > _default_real_properties;
 
@@ -23,6 +23,7 @@
 #include "libmesh/elem.h"
 #include "libmesh/quadrature.h"
 #include "libmesh/mesh.h"
+#include "libmesh/elem_range.h"
 
 #include <vector>
 #include <map>
@@ -158,6 +159,38 @@ public:
    */
   bool hasOlderProperties() const { return _has_older_prop; }
 
+  /**
+   * Switch to the "slab" storage engine: instead of one heap allocated PropertyValue per
+   * element/side/property kept in hash maps, every stateful property (and state) lives in one
+   * contiguous array indexed by a precomputed per-element offset.  Lookups are O(1) without
+   * locking and shift() just rotates the arrays.  Values are copied in and out of MaterialData
+   * instead of being swapped.  Only volumetric (side 0) storage on a fixed mesh is supported.
+   */
+  void useSlabStorage(bool use = true) { _use_slabs = use; }
+
+  /**
+   * @return Whether or not the slab storage engine is used
+   */
+  bool usingSlabStorage() const { return _use_slabs; }
+
+  /**
+   * Compute the slab layout: each element in the range gets max_qps consecutive entries.
+   * Must be called before the stateful properties are initialized.
+   * @param elem_range The elements that will have stateful properties
+   * @param max_qps The maximum number of quadrature points on any element
+   * @param max_elem_id One more than the largest element id in the mesh
+   */
+  void initSlabs(const ConstElemRange & elem_range, unsigned int max_qps, dof_id_type max_elem_id);
+
+  ///@{
+  /**
+   * Access methods to the slab data (indexed by stateful property id)
+   */
+  MaterialProperties & slabs() { return _slabs; }
+  MaterialProperties & slabsOld() { return _slabs_old; }
+  MaterialProperties & slabsOlder() { return _slabs_older; }
+  ///@}
+
   ///@{
   /**
    * Access methods to the stored material property data
@@ -212,12 +245,48 @@ protected:
   unsigned int addPropertyId (const std::string & prop_name);
 
   void sizeProps(MaterialProperties & mp, unsigned int size);
+
+  /// initStatefulProps() for the slab storage engine
+  void initStatefulPropsSlab(MaterialData & material_data, std::vector<Material *> & mats, unsigned int n_qpoints, const Elem & elem, unsigned int side);
+
+  /// The index of the first slab entry belonging to elem
+  unsigned int slabOffset(const Elem & elem) const;
+
+  /// Whether or not to use the contiguous slab storage instead of the hash maps
+  bool _use_slabs;
+
+  /// The number of slab entries reserved per element (the maximum number of qps)
+  unsigned int _slab_stride;
+
+  /// Total number of entries in each slab
+  unsigned int _slab_size;
+
+  /// Offset of each element's entries in the slabs, indexed by element id
+  std::vector<unsigned int> _slab_offsets;
+
+  ///@{ One contiguous PropertyValue per stateful property for each state (rotated by shift())
+  MaterialProperties _slabs;
+  MaterialProperties _slabs_old;
+  MaterialProperties _slabs_older;
+  ///@}
 };
 
 template<>
 inline void
 dataStore(std::ostream & stream, MaterialPropertyStorage & storage, void * context)
 {
+  if (storage.usingSlabStorage())
+  {
+    // The slab layout is rebuilt from the (identical) mesh, so only the values are stored
+    dataStore(stream, storage.slabs(), context);
+    dataStore(stream, storage.slabsOld(), context);
+
+    if (storage.hasOlderProperties())
+      dataStore(stream, storage.slabsOlder(), context);
+
+    return;
+  }
+
   dataStore(stream, storage.props(), context);
   dataStore(stream, storage.propsOld(), context);
 
@@ -229,6 +298,17 @@ template<>
 inline void
 dataLoad(std::istream & stream, MaterialPropertyStorage & storage, void * context)
 {
+  if (storage.usingSlabStorage())
+  {
+    dataLoad(stream, storage.slabs(), context);
+    dataLoad(stream, storage.slabsOld(), context);
+
+    if (storage.hasOlderProperties())
+      dataLoad(stream, storage.slabsOlder(), context);
+
+    return;
+  }
+
   dataLoad(stream, storage.props(), context);
   dataLoad(stream, storage.propsOld(), context);
 
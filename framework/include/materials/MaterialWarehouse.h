@@ -73,6 +73,25 @@ public:
 
   std::vector<Material *> & active(SubdomainID block_id);
 
+  ///@{
+  /**
+   * Restrict the volume materials returned by getActiveMaterials() to the ones needed to compute
+   * the given material properties (see setActiveMaterialProperties). The selection for each
+   * property set and block is computed once and cached.
+   */
+  void setActiveMaterialProperties(const std::set<std::string> & mat_prop_names);
+  void clearActiveMaterialProperties();
+  bool hasActiveMaterialProperties() const { return _current_needed_materials != NULL; }
+  ///@}
+
+  /**
+   * Return the volume materials on the block that must be computed for the active material
+   * properties. If no active material properties were set, all of the materials are returned.
+   * @param block_id The subdomain ID
+   * @return The dependency ordered materials that have to be computed
+   */
+  std::vector<Material *> & getActiveMaterials(SubdomainID block_id);
+
   void addMaterial(std::vector<SubdomainID> blocks, MooseSharedPointer<Material> & material);
   void addFaceMaterial(std::vector<SubdomainID> blocks, MooseSharedPointer<Material> & material);
   void addNeighborMaterial(std::vector<SubdomainID> blocks, MooseSharedPointer<Material> & material);
@@ -121,6 +140,15 @@ protected:
   /// list of materials by name
   std::map<std::string, std::vector<Material *> > _mat_by_name;
 
+  /// Cache of the volume materials needed for a set of material properties, per block
+  std::map<std::set<std::string>, std::map<SubdomainID, std::vector<Material *> > > _needed_materials;
+
+  /// The entry of _needed_materials for the currently active material properties (NULL if none)
+  std::map<SubdomainID, std::vector<Material *> > * _current_needed_materials;
+
+  /// The currently active material properties (the key of _current_needed_materials)
+  const std::set<std::string> * _current_needed_props;
+
 private:
   /**
    * We are using MooseSharedPointer to handle the cleanup of the pointers at the end of execution.
@@ -134,6 +162,14 @@ private:
    */
   void sortMaterials(std::vector<Material *> & materials_vector);
 
+  /**
+   * Select from the dependency ordered materials the ones that supply one of the needed properties,
+   * including the materials that those depend on. Materials with stateful properties or
+   * without any declared properties are always selected.
+   */
+  void selectNeededMaterials(const std::vector<Material *> & materials, const std::set<std::string> & needed_props,
+                             std::vector<Material *> & selected) const;
+
   /**
    * This routine checks to make sure that all requests for material properties, specifically
    * by other materials make sense for the given block.
@@ -114,6 +114,14 @@ public:
    */
   std::vector<BoundaryID> boundaryIDs(const Elem *const elem, const unsigned short int side) const;
 
+  /**
+   * Fills the passed vector with the boundary IDs for the requested element on the
+   * requested side.  This is served from a table built in cacheInfo() so, as long as the
+   * caller reuses the same vector, it does not allocate.  Elements created since the last
+   * update() fall back to querying the BoundaryInfo object.
+   */
+  void boundaryIDs(const Elem *const elem, const unsigned short int side, std::vector<BoundaryID> & ids) const;
+
   /**
    * Returns a const reference to a set of all user-specified
    * boundary IDs.
@@ -224,6 +232,13 @@ public:
    */
   void meshChanged();
 
+  /**
+   * The number of times meshChanged() has been called.  Unlike the _is_changed flag,
+   * which the output system resets, this can be used to invalidate data cached by
+   * clients of the MooseMesh.
+   */
+  unsigned int changeCount() const { return _change_count; }
+
   /**
   * Declares a callback function that is executed at the conclusion
   * of meshChanged(). Ther user can implement actions required after
@@ -716,6 +731,9 @@ protected:
   /// true if mesh is changed (i.e. after adaptivity step)
   bool _is_changed;
 
+  /// The number of calls to meshChanged()
+  unsigned int _change_count;
+
   /// True if a Nemesis Mesh was read in
   bool _is_nemesis;
 
@@ -923,6 +941,15 @@ private:
   /// Holds a map from subomdain ids to the boundary ids that are attached to it
   std::map<unsigned int, std::set<unsigned int> > _subdomain_boundary_ids;
 
+  /**
+   * Compressed (CSR) table of the boundary IDs on every element side.  The IDs for side s of
+   * element e are _side_bnd_ids[_side_bnd_offsets[k]] ... _side_bnd_ids[_side_bnd_offsets[k+1] - 1]
+   * with k = _elem_side_offsets[e->id()] + s.
+   */
+  std::vector<dof_id_type> _elem_side_offsets;
+  std::vector<dof_id_type> _side_bnd_offsets;
+  std::vector<BoundaryID> _side_bnd_ids;
+
   /// Whether or not this Mesh is allowed to read a recovery file
   bool _allow_recovery;
 };
@@ -84,7 +84,17 @@ public:
 
 protected:
 
-  void updateCheckpointFiles(CheckpointFileNames file_struct);
+  /**
+   * Add the files to the list of stored checkpoints and remove the oldest ones
+   * @param file_struct The files of the newest checkpoint
+   * @param warn Whether failures to remove a file are reported
+   */
+  void updateCheckpointFiles(CheckpointFileNames file_struct, bool warn = true);
+
+  /**
+   * Wait for an asynchronous restartable data write and then rotate the checkpoint files
+   */
+  void finishPendingWrite();
 
 private:
 
@@ -97,6 +107,9 @@ private:
   /// True if outputing checkpoint files in binary format
   bool _binary;
 
+  /// True if the restartable data is written from a background thread
+  bool _asynchronous;
+
   /// Reference to the restartable data
   const RestartableDatas & _restartable_data;
 
@@ -114,6 +127,12 @@ private:
 
   /// Vector of checkpoint filename structures
   std::deque<CheckpointFileNames> _file_names;
+
+  /// True while an asynchronous write has not been waited for
+  bool _write_pending;
+
+  /// Files of the pending asynchronous write
+  CheckpointFileNames _pending_file_names;
 };
 
 #endif //CHECKPOINT_H
@@ -0,0 +1,44 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef NUMJACOBIANEVALUATIONS_H
+#define NUMJACOBIANEVALUATIONS_H
+
+#include "GeneralPostprocessor.h"
+
+//Forward Declarations
+class NumJacobianEvaluations;
+
+template<>
+InputParameters validParams<NumJacobianEvaluations>();
+
+/**
+ * Just returns the total number of Jacobian evaluations performed, not counting the
+ * Jacobians assembled together with a residual.
+ */
+class NumJacobianEvaluations : public GeneralPostprocessor
+{
+public:
+  NumJacobianEvaluations(const InputParameters & parameters);
+
+  virtual void initialize() {}
+  virtual void execute() {}
+
+  /**
+   * This will return the number of Jacobian evaluations.
+   */
+  virtual Real getValue();
+};
+
+#endif //NUMJACOBIANEVALUATIONS_H
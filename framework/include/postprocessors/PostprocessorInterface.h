@@ -17,6 +17,7 @@
 
 // Standard includes
 #include <map>
+#include <set>
 #include <string>
 
 // MOOSE includes
@@ -95,6 +96,12 @@ public:
    */
   bool hasPostprocessorByName(const PostprocessorName & name);
 
+  /**
+   * Get the names of the Postprocessors whose current values this object has retrieved
+   * @return The set of Postprocessor names
+   */
+  const std::set<std::string> & getPostprocessorDependencies() const { return _pi_dependencies; }
+
 private:
 
   /// Reference the the FEProblem class
@@ -102,6 +109,9 @@ private:
 
   /// PostprocessorInterface Parameters
   const InputParameters & _ppi_params;
+
+  /// The names of the Postprocessors whose current values were retrieved through this interface
+  std::set<std::string> _pi_dependencies;
 };
 
 #endif //POSTPROCESSORINTERFACE_H
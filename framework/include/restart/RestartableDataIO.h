@@ -18,9 +18,15 @@
 #include "Moose.h"
 #include "DataIO.h"
 
+// libMesh includes
+#include "libmesh/threads.h"
+
 #include <sstream>
+#include <streambuf>
 #include <string>
 #include <list>
+#include <vector>
+#include <cstring>
 
 class RestartableDatas;
 class RestartableDataValue;
@@ -77,6 +83,60 @@ dataLoad(std::istream & stream, Backup * & backup, void * context)
 }
 
 
+/**
+ * A growable in-memory output buffer for restartable data.
+ *
+ * The data is stored straight into the buffer through an std::ostream and the size fields that
+ * precede each datum are filled in afterwards, so nothing is copied through intermediate strings.
+ * The storage is kept between uses: after the first checkpoint it is already large enough.
+ */
+class RestartableDataBuffer : public std::streambuf
+{
+public:
+  RestartableDataBuffer() {}
+
+  /// Number of bytes written so far
+  std::size_t size() const { return _data.size(); }
+
+  /// Pointer to the written bytes
+  const char * data() const { return _data.empty() ? NULL : &_data[0]; }
+
+  /// Discard the contents while keeping the allocated storage
+  void clear() { _data.clear(); }
+
+  /// Overwrite n bytes starting at pos, which must have been written already
+  void patch(std::size_t pos, const void * bytes, std::size_t n)
+  {
+    mooseAssert(pos + n <= _data.size(), "Patching past the end of the buffer");
+    std::memcpy(&_data[pos], bytes, n);
+  }
+
+protected:
+  virtual int_type overflow(int_type ch)
+  {
+    if (!traits_type::eq_int_type(ch, traits_type::eof()))
+      _data.push_back(traits_type::to_char_type(ch));
+    return traits_type::not_eof(ch);
+  }
+
+  virtual std::streamsize xsputn(const char * s, std::streamsize n)
+  {
+    _data.insert(_data.end(), s, s + n);
+    return n;
+  }
+
+  /// Only supports querying the put position (i.e. tellp())
+  virtual pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which)
+  {
+    if (off == 0 && dir == std::ios_base::cur && (which & std::ios_base::out))
+      return pos_type(off_type(_data.size()));
+    return pos_type(off_type(-1));
+  }
+
+private:
+  std::vector<char> _data;
+};
+
 /**
  * Class for doing restart.
  *
@@ -94,6 +154,25 @@ public:
    */
   void writeRestartableData(std::string base_file_name, const RestartableDatas & restartable_datas, std::set<std::string> & _recoverable_data);
 
+  /**
+   * Serialize the restartable data into memory and write the files from a background thread.
+   * The data may be modified as soon as this returns; call waitForWrite() before relying on the
+   * files being on disk.
+   */
+  void writeRestartableDataAsync(std::string base_file_name, const RestartableDatas & restartable_datas);
+
+  /**
+   * Block until a write started by writeRestartableDataAsync() has finished.
+   */
+  void waitForWrite();
+
+  /**
+   * Block until a write started by writeRestartableDataAsync() has finished without
+   * reporting a failure, so it can be used from destructors.
+   * @return Whether all of the files were written
+   */
+  bool finishWrite();
+
   /**
    * Read restartable data header to verify that we are restarting on the correct number of processors and threads.
    */
@@ -115,11 +194,30 @@ public:
   void restoreBackup(MooseSharedPointer<Backup> backup);
 
 private:
+  /// Functor executed by the background writer thread
+  class AsyncWriter;
+
   /**
    * Serializes the data into the stream object.
    */
   void serializeRestartableData(const std::map<std::string, RestartableDataValue *> & restartable_data, std::ostream & stream);
 
+  /**
+   * Serializes the data into the buffer, replacing its contents.
+   */
+  void serializeRestartableData(const std::map<std::string, RestartableDataValue *> & restartable_data, RestartableDataBuffer & buffer);
+
+  /**
+   * Serializes the data of all threads into the output buffers and sets the output file names.
+   */
+  void bufferRestartableData(const std::string & base_file_name, const RestartableDatas & restartable_datas);
+
+  /**
+   * Writes the output buffers to their files. Does not call into the rest of MOOSE so it can be
+   * run from the writer thread; failures are reported by waitForWrite().
+   */
+  void writeBuffers();
+
   /**
    * Deserializes the data from the stream object.
    */
@@ -140,6 +238,18 @@ private:
 
   /// A vector of file handles, one per thread
   std::vector<std::ifstream *> _in_file_handles;
+
+  /// Serialized restartable data waiting to be written, one per thread
+  std::vector<RestartableDataBuffer *> _out_buffers;
+
+  /// File names for the output buffers
+  std::vector<std::string> _out_file_names;
+
+  /// Thread writing the output buffers (NULL when no write is pending)
+  Threads::Thread * _writer_thread;
+
+  /// Name of the file that could not be written (empty if all writes succeeded)
+  std::string _failed_file_name;
 };
 
 #endif /* RESTARTABLEDATAIO_H */
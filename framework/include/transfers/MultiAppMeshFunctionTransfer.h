@@ -19,6 +19,7 @@
 
 class MooseVariable;
 class MultiAppMeshFunctionTransfer;
+class KDTreeElementLocator;
 
 template<>
 InputParameters validParams<MultiAppMeshFunctionTransfer>();
@@ -42,6 +43,21 @@ protected:
   AuxVariableName _to_var_name;
   VariableName _from_var_name;
   bool _error_on_miss;
+
+  /**
+   * Rebuild the element locators over the local parts of the "from" meshes that
+   * changed since the last execution.
+   */
+  void updateLocators();
+
+  /// Element locators over the local parts of the "from" meshes, kept across executions
+  std::vector<MooseSharedPointer<KDTreeElementLocator> > _local_locators;
+
+  /// The mesh each of the locators was built for
+  std::vector<MooseMesh *> _locator_meshes;
+
+  /// MooseMesh::changeCount() of each mesh when its locator was built
+  std::vector<unsigned int> _locator_change_counts;
 };
 
 #endif /* MULTIAPPMESHFUNCTIONTRANSFER_H */
@@ -19,6 +19,7 @@
 
 class MooseVariable;
 class MultiAppNearestNodeTransfer;
+class KDTree;
 
 template<>
 InputParameters validParams<MultiAppNearestNodeTransfer>();
@@ -31,7 +32,7 @@ class MultiAppNearestNodeTransfer :
 {
 public:
   MultiAppNearestNodeTransfer(const InputParameters & parameters);
-  virtual ~MultiAppNearestNodeTransfer() {}
+  virtual ~MultiAppNearestNodeTransfer();
 
   virtual void initialSetup();
 
@@ -70,6 +71,14 @@ protected:
 
   void getLocalNodes(MooseMesh * mesh, std::vector<Node *> & local_nodes);
 
+  /**
+   * Make sure there is an up to date KDTree over the local source nodes of every
+   * "from" domain owned by this processor.  A tree is only rebuilt when the set of
+   * source nodes changed or when any of them (or the app itself) moved.
+   * @param local_nodes The local source nodes for each local "from" domain
+   */
+  void updateKDTrees(const std::vector<std::vector<Node *> > & local_nodes);
+
   AuxVariableName _to_var_name;
   VariableName _from_var_name;
 
@@ -88,6 +97,12 @@ protected:
   std::vector< std::vector<dof_id_type> > & _cached_dof_ids;
   std::map<unsigned int, unsigned int> & _cached_from_inds;
   std::map<unsigned int, unsigned int> & _cached_qp_inds;
+
+  /// One tree per local "from" domain over its source nodes (shifted by the app position)
+  std::vector<KDTree *> _kd_trees;
+
+  /// The source nodes each tree in _kd_trees was built over (tree indices refer to these)
+  std::vector<std::vector<Node *> > _kd_tree_nodes;
 };
 
 #endif /* MULTIAPPNEARESTNODETRANSFER_H */
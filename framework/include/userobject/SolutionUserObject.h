@@ -24,11 +24,11 @@ namespace libMesh
   class Mesh;
   class EquationSystems;
   class System;
-  class MeshFunction;
   template<class T> class NumericVector;
 }
 
 class SolutionUserObject;
+class KDTreeElementLocator;
 
 template<>
 InputParameters validParams<SolutionUserObject>();
@@ -57,6 +57,28 @@ public:
    */
   virtual Real pointValue(Real t, const Point & p, const std::string & var_name) const;
 
+  /**
+   * Returns a value at a specific location and variable, searching the element that contained
+   * the previous point first
+   * @param t The time at which to extract (see pointValue)
+   * @param p The location at which to return a value
+   * @param var_name The variable that is desired
+   * @param elem_hint The element tried first, set to the element containing p
+   * @return The desired value for the given variable at a location
+   */
+  Real pointValue(Real t, const Point & p, const std::string & var_name, const Elem * & elem_hint) const;
+
+  /**
+   * Returns the values at many locations for a variable.  The element containing
+   * each point is used as the starting guess for the next one, so ordering the points
+   * by location (e.g. the quadrature points of an element) makes the lookups nearly free.
+   * @param t The time at which to extract (see pointValue)
+   * @param points The locations at which to return a value
+   * @param var_name The variable that is desired
+   * @param values Filled with the value at each point
+   */
+  void pointValues(Real t, const std::vector<Point> & points, const std::string & var_name, std::vector<Real> & values) const;
+
   /**
    * Return a value directly from a Node
    * @param node A pointer to the node at which a value is desired
@@ -133,12 +155,26 @@ protected:
   bool updateExodusBracketingTimeIndices(Real time);
 
   /**
-   * A wrapper method for calling the various MeshFunctions used for reading the data
-   * @param p The location at which data is desired
-   * @param var_name The variable name to extract data from
-   * @param func_num The MeshFunction index to use (1 = _mesh_function; 2 = _mesh_function2)
+   * Apply the coordinate transformations to a point of the simulation
+   * @param p The location in the simulation
+   * @return The corresponding location in the mesh being read
+   */
+  Point transformPoint(const Point & p) const;
+
+  /**
+   * Look up the libMesh variable number of a variable that is read
+   * @param var_name The variable name
    */
-  Real evalMeshFunction(const Point & p, std::string var_name, unsigned int func_num) const;
+  unsigned int variableNumber(const std::string & var_name) const;
+
+  /**
+   * Evaluate the read solution(s) at a point, interpolating in time if needed
+   * @param t The time at which to extract
+   * @param pt The (already transformed) location at which data is desired
+   * @param var_num The variable number to extract data from
+   * @param elem The element containing pt (NULL if the point could not be located)
+   */
+  Real evalSolution(Real t, const Point & pt, unsigned int var_num, const Elem * elem) const;
 
   /// File type to read (0 = xda; 1 = ExodusII)
   MooseEnum _file_type;
@@ -155,7 +191,7 @@ protected:
   /// A list of variables to extract from the read system
   std::vector<std::string> _system_variables;
 
-  /// Stores the local index need by MeshFunction
+  /// Stores the libMesh variable number of each variable that is read
   std::map<std::string, unsigned int> _local_variable_index;
 
   /// Stores flag indicating if the variable is nodal
@@ -176,8 +212,8 @@ protected:
   /// Pointer libMesh::System class storing the read solution
   System * _system;
 
-  /// Pointer the libMesh::MeshFunction object that the read data is stored
-  MeshFunction * _mesh_function;
+  /// Locates the elements of _mesh containing the requested points
+  KDTreeElementLocator * _locator;
 
   /// Pointer to the libMesh::ExodusII used to read the files
   ExodusII_IO *_exodusII_io;
@@ -191,9 +227,6 @@ protected:
   /// Pointer to a second libMesh::System object, used for interpolation
   System * _system2;
 
-  /// Pointer to second libMesh::MeshFuntion, used for interpolation
-  MeshFunction * _mesh_function2;
-
   /// Pointer to second serial solution, used for interpolation
   NumericVector<Number> * _serialized_solution2;
 
@@ -15,6 +15,9 @@
 #ifndef USEROBJECTINTERFACE_H
 #define USEROBJECTINTERFACE_H
 
+#include <set>
+#include <string>
+
 #include "InputParameters.h"
 #include "ParallelUniqueId.h"
 #include "MooseTypes.h"
@@ -64,6 +67,12 @@ public:
    */
   const UserObject & getUserObjectBaseByName(const std::string & name);
 
+  /**
+   * Get the names of the user objects this object has retrieved
+   * @return The set of user object names
+   */
+  const std::set<std::string> & getUserObjectDependencies() const { return _uoi_dependencies; }
+
 private:
   /// Reference to the FEProblem instance
   FEProblem & _uoi_feproblem;
@@ -73,6 +82,9 @@ private:
 
   /// Parameters of the object with this interface
   const InputParameters & _uoi_params;
+
+  /// The names of the user objects retrieved through this interface
+  std::set<std::string> _uoi_dependencies;
 };
 
 
@@ -80,6 +92,7 @@ template<class T>
 const T &
 UserObjectInterface::getUserObject(const std::string & name)
 {
+  _uoi_dependencies.insert(_uoi_params.get<UserObjectName>(name));
   return _uoi_feproblem.getUserObject<T>(_uoi_params.get<UserObjectName>(name));
 }
 
@@ -87,6 +100,7 @@ template<class T>
 const T &
 UserObjectInterface::getUserObjectByName(const std::string & name)
 {
+  _uoi_dependencies.insert(name);
   return _uoi_feproblem.getUserObject<T>(name);
 }
 
@@ -0,0 +1,111 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef KDTREE_H
+#define KDTREE_H
+
+#include "Moose.h"
+
+// libMesh includes
+#include "libmesh/point.h"
+
+// System includes
+#include <vector>
+
+/**
+ * A static k-d tree over a set of points in up to three dimensions.
+ *
+ * The tree is built once in O(N log N) and answers "n nearest points" and
+ * "all points within a radius" queries in O(log N) on average.  The tree stores
+ * its own copy of the points, so it stays valid after the original container
+ * (or the mesh the points came from) has changed.  Query results are indices into
+ * the vector of points the tree was built from.
+ */
+class KDTree
+{
+public:
+  /**
+   * @param points The points to build the tree over
+   * @param max_leaf_size The maximum number of points stored in a leaf
+   */
+  KDTree(const std::vector<Point> & points, unsigned int max_leaf_size = 10);
+
+  /**
+   * Find the (up to) n points closest to the query point.
+   * @param query_point The point to search around
+   * @param n The number of neighbors to find
+   * @param indices Filled with the indices of the neighbors, sorted by increasing distance
+   * @param distances_sq Filled with the squared distances of the neighbors
+   */
+  void neighborSearch(const Point & query_point, unsigned int n,
+                      std::vector<std::size_t> & indices, std::vector<Real> & distances_sq) const;
+
+  /**
+   * Find the index of the point closest to the query point (the tree must not be empty)
+   */
+  std::size_t nearest(const Point & query_point) const;
+
+  /**
+   * Find all points within a distance of the query point (unsorted).
+   */
+  void radiusSearch(const Point & query_point, Real radius, std::vector<std::size_t> & indices) const;
+
+  /**
+   * The number of points in the tree
+   */
+  std::size_t size() const { return _points.size(); }
+
+  /**
+   * The point the tree was built with at the given index
+   */
+  const Point & point(std::size_t index) const { return _points[index]; }
+
+protected:
+  /// A node of the tree.  Leaves own the index range [_begin, _end) of _index.
+  struct TreeNode
+  {
+    std::size_t _begin;
+    std::size_t _end;
+    unsigned int _split_dim;
+    Real _split_value;
+    /// Positions of the children in _nodes (both invalid for leaves)
+    std::size_t _left;
+    std::size_t _right;
+  };
+
+  /// Recursively build the subtree over _index[begin, end) and return its position in _nodes
+  std::size_t build(std::size_t begin, std::size_t end);
+
+  /// Max-heap entry (squared distance, point index) used while gathering the nearest points
+  typedef std::pair<Real, std::size_t> HeapEntry;
+
+  void neighborSearch(std::size_t node, const Point & query_point, unsigned int n, std::vector<HeapEntry> & heap) const;
+
+  void radiusSearch(std::size_t node, const Point & query_point, Real radius_sq, std::vector<std::size_t> & indices) const;
+
+  /// Copy of the points the tree was built over
+  std::vector<Point> _points;
+
+  /// Permutation of the point indices so that every tree node owns a contiguous range
+  std::vector<std::size_t> _index;
+
+  /// Flat storage for the tree nodes; the root is _nodes[0]
+  std::vector<TreeNode> _nodes;
+
+  unsigned int _max_leaf_size;
+
+  static const std::size_t _invalid;
+};
+
+#endif // KDTREE_H
@@ -0,0 +1,116 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef KDTREEELEMENTLOCATOR_H
+#define KDTREEELEMENTLOCATOR_H
+
+#include "Moose.h"
+
+// libMesh includes
+#include "libmesh/mesh_tools.h"
+
+// System includes
+#include <vector>
+
+class KDTree;
+
+// libMesh forward declarations
+namespace libMesh
+{
+class MeshBase;
+class Elem;
+class System;
+template <typename T> class NumericVector;
+}
+
+/**
+ * Finds the element containing a point using k-d trees over the element centroids.
+ *
+ * Every element is bounded by the sphere around its centroid through its farthest
+ * node, so the only candidates for a point are the elements whose centroid lies within
+ * that radius of it.  The elements are binned by radius (each bin spans a factor of two)
+ * with one tree per bin, so that a few large elements in a graded mesh do not widen the
+ * search among the small ones.  The candidates pulled from the trees are filtered by
+ * their own radius and then checked with Elem::contains_point().  When several elements
+ * contain the point (it sits on a shared side) the one with the lowest id wins, unless a
+ * hint that contains the point was given (like the last element cache of libMesh's
+ * PointLocatorTree).
+ *
+ * The locator stores pointers to the elements, so it must be rebuilt whenever the
+ * mesh changes.
+ */
+class KDTreeElementLocator
+{
+public:
+  /**
+   * @param mesh The mesh to search
+   * @param local_only Only consider the active elements owned by this processor,
+   *                   which is all that is needed to evaluate a distributed solution
+   */
+  KDTreeElementLocator(const MeshBase & mesh, bool local_only = false);
+
+  virtual ~KDTreeElementLocator();
+
+  /**
+   * Find the element containing a point.
+   * @param p The point to locate
+   * @param hint An element to try before searching, typically the result of the previous
+   *             query when the points are spatially coherent
+   * @return The element containing the point or NULL if it is outside of the searched elements
+   */
+  const Elem * locate(const Point & p, const Elem * hint = NULL) const;
+
+  /**
+   * Find the elements containing a set of points, reusing the previous element as the
+   * hint for the next point.
+   * @param points The points to locate
+   * @param elems Filled with the element containing each point (NULL for misses)
+   */
+  void locate(const std::vector<Point> & points, std::vector<const Elem *> & elems) const;
+
+  /**
+   * The bounding box of the searched elements
+   */
+  const MeshTools::BoundingBox & boundingBox() const { return _bbox; }
+
+  /**
+   * Evaluate a variable at a point inside an element.
+   * @param sys The system the variable belongs to
+   * @param solution The solution vector, it only has to hold the dofs of the element
+   *                 (i.e. a ghosted current_local_solution is fine for local elements)
+   * @param var_num The variable number within sys
+   * @param elem The element containing the point
+   * @param p The physical point to evaluate at
+   */
+  static Real value(const System & sys, const NumericVector<Number> & solution, unsigned int var_num,
+                    const Elem * elem, const Point & p);
+
+protected:
+  /// The searched elements of each radius bin, in the order its tree was built with
+  std::vector<std::vector<const Elem *> > _elems;
+
+  /// The bounding radius around the centroid of each element of each bin
+  std::vector<std::vector<Real> > _radii;
+
+  /// The largest bounding radius in each bin
+  std::vector<Real> _max_radii;
+
+  /// Tree over the element centroids of each bin
+  std::vector<KDTree *> _kd_trees;
+
+  /// Bounding box of all of the searched elements, used to reject far away points quickly
+  MeshTools::BoundingBox _bbox;
+};
+
+#endif // KDTREEELEMENTLOCATOR_H
@@ -36,7 +36,9 @@ public:
                       const std::vector<double> & Y);
   LinearInterpolation() :
     _x(std::vector<double>()),
-    _y(std::vector<double>()) {}
+    _y(std::vector<double>()),
+    _uniform(false),
+    _inv_dx(0) {}
 
   virtual ~LinearInterpolation()
     {}
@@ -59,12 +61,42 @@ public:
    */
   double sample(double x) const;
 
+  /**
+   * Sample the fit, starting the interval search from a caller owned hint.  Most queries
+   * (time stepping, consecutive qps) land in the same or the next interval as the previous one,
+   * so keeping the hint between calls makes those lookups O(1).
+   * @param x The value of the independent variable
+   * @param interval The interval to check first, updated to the interval containing x
+   */
+  double sample(double x, unsigned int & interval) const;
+
+  /**
+   * Sample the fit at all of the given independent variable values at once.
+   * @param x The values of the independent variable
+   * @param y Filled with the values of the dependent variable (resized to match x)
+   */
+  void sample(const std::vector<double> & x, std::vector<double> & y) const;
+
   /**
    * This function will take an independent variable input and will return the derivative of the dependent variable
    * with respect to the independent variable based on the generated fit
    */
   double sampleDerivative(double x) const;
 
+  /**
+   * Sample the derivative of the fit, starting the interval search from a caller owned hint
+   * @param x The value of the independent variable
+   * @param interval The interval to check first, updated to the interval containing x
+   */
+  double sampleDerivative(double x, unsigned int & interval) const;
+
+  /**
+   * Sample the derivative of the fit at all of the given independent variable values at once.
+   * @param x The values of the independent variable
+   * @param dy Filled with the derivatives (resized to match x)
+   */
+  void sampleDerivative(const std::vector<double> & x, std::vector<double> & dy) const;
+
   /**
    * This function will dump GNUPLOT input files that can be run to show the data points and
    * function fits
@@ -85,10 +117,22 @@ public:
   double range(int i) const;
 
 private:
+  /**
+   * Find i such that _x[i] <= x < _x[i+1].  x must lie strictly inside the
+   * domain: callers handle the endpoint cases.
+   * @param interval The interval to try first, set to the result
+   */
+  unsigned int findInterval(double x, unsigned int & interval) const;
 
   std::vector<double> _x;
   std::vector<double> _y;
 
+  /// Whether the abscissas are (to round-off) equally spaced, allowing direct indexing
+  bool _uniform;
+
+  /// 1 / spacing of the abscissas (only meaningful if _uniform)
+  double _inv_dx;
+
   static int _file_number;
 };
 
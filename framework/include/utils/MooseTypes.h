@@ -159,6 +159,7 @@ enum SolveType
   ST_JFNK,             ///< Jacobian-Free Newton Krylov
   ST_NEWTON,           ///< Full Newton Solve
   ST_FD,               ///< Use finite differences to compute Jacobian
+  ST_MATRIX_FREE,      ///< Newton Krylov with an element-by-element Jacobian action
   ST_LINEAR            ///< Solving a linear problem
 };
 
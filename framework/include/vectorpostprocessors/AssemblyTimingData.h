@@ -0,0 +1,68 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef ASSEMBLYTIMINGDATA_H
+#define ASSEMBLYTIMINGDATA_H
+
+#include "GeneralVectorPostprocessor.h"
+
+//Forward Declarations
+class AssemblyTimingData;
+class AssemblyTimings;
+
+template<>
+InputParameters validParams<AssemblyTimingData>();
+
+/**
+ * Reports the timings recorded by the threaded residual or Jacobian loops: either the element
+ * count and wall time of every thread on every processor, the element count and time spent on
+ * each subdomain, or the number of elements visited per loop in each subdomain.
+ * Adding this object turns on the recording.
+ */
+class AssemblyTimingData : public GeneralVectorPostprocessor
+{
+public:
+  AssemblyTimingData(const InputParameters & parameters);
+
+  virtual ~AssemblyTimingData() {}
+
+  virtual void initialize();
+  virtual void execute();
+  virtual void finalize();
+
+protected:
+  /// Which data to report: "threads", "subdomains" or "elements"
+  MooseEnum _data;
+
+  AssemblyTimings & _timings;
+
+  /// The processor and thread ids of each entry (threads only)
+  VectorPostprocessorValue * _processor;
+  VectorPostprocessorValue * _thread;
+
+  /// The subdomain id of each entry (subdomains and elements only)
+  VectorPostprocessorValue * _subdomain;
+
+  /// The number of elements visited by each thread or in each subdomain (threads and subdomains only)
+  VectorPostprocessorValue * _elements;
+
+  /// The number of elements visited per loop in each subdomain (elements only)
+  VectorPostprocessorValue * _elements_per_loop;
+
+  /// The accumulated wall time of each entry (threads and subdomains only)
+  VectorPostprocessorValue * _time;
+};
+
+#endif // ASSEMBLYTIMINGDATA_H
@@ -67,14 +67,16 @@ protected:
   class BubbleData
   {
   public:
-    BubbleData(std::set<dof_id_type> & entity_ids, unsigned int var_idx) :
+    BubbleData(const std::vector<dof_id_type> & entity_ids, unsigned int var_idx) :
         _entity_ids(entity_ids),
         _var_idx(var_idx),
         _intersects_boundary(false)
     {}
 
-    std::set<dof_id_type> _entity_ids;
-    std::set<dof_id_type> _periodic_nodes;
+    /// The ids of the flooded entities, sorted and unique
+    std::vector<dof_id_type> _entity_ids;
+    /// The periodic neighbor nodes of the flooded entities, sorted and unique
+    std::vector<dof_id_type> _periodic_nodes;
     unsigned int _var_idx;
     bool _intersects_boundary;
   };
@@ -102,7 +104,8 @@ protected:
 
   /**
    * This routine merges the data in _bubble_sets from separate threads/processes to resolve
-   * any bubbles that were counted as unique by multiple processors.
+   * any bubbles that were counted as unique by multiple processors.  Pieces that share an
+   * entity (or a periodic node) are joined with a union-find over the sorted entity ids.
    */
   void mergeSets(bool use_periodic_boundary_info);
 
@@ -143,8 +146,8 @@ protected:
    * This method detects whether two sets intersect without building a result set.  It exits as soon as
    * any intersection is detected.
    */
-  template<class InputIterator>
-  inline bool setsIntersect(InputIterator first1, InputIterator last1, InputIterator first2, InputIterator last2) const
+  template<class InputIterator1, class InputIterator2>
+  inline bool setsIntersect(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2) const
     {
       while (first1 != last1 && first2 != last2)
       {
@@ -0,0 +1,79 @@
+#
+# Test that the derivatives of DerivativeParsedMaterial are correct when
+# vanishing derivatives (here all derivatives of dF/deta with respect to
+# eta) are not differentiated any further.
+#
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 1
+  ny = 1
+  elem_type = QUAD4
+[]
+
+[AuxVariables]
+  [./c]
+    [./InitialCondition]
+      type = ConstantIC
+      value = 0.5
+    [../]
+  [../]
+  [./eta]
+    [./InitialCondition]
+      type = ConstantIC
+      value = 0.25
+    [../]
+  [../]
+[]
+
+[Materials]
+  [./free_energy]
+    type = DerivativeParsedMaterial
+    block = 0
+    f_name = F
+    args = 'c eta'
+    function = 'c^3 + eta*c'
+    derivative_order = 3
+  [../]
+[]
+
+[Postprocessors]
+  [./F]
+    type = ElementIntegralMaterialProperty
+    mat_prop = F
+  [../]
+  [./dFdc]
+    type = ElementIntegralMaterialProperty
+    mat_prop = dF/dc
+  [../]
+  [./dFdeta]
+    type = ElementIntegralMaterialProperty
+    mat_prop = dF/deta
+  [../]
+  [./d2Fdc2]
+    type = ElementIntegralMaterialProperty
+    mat_prop = d^2F/dc^2
+  [../]
+  [./d2Fdcdeta]
+    type = ElementIntegralMaterialProperty
+    mat_prop = d^2F/dcdeta
+  [../]
+  [./d3Fdc3]
+    type = ElementIntegralMaterialProperty
+    mat_prop = d^3F/dc^3
+  [../]
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  execute_on = 'timestep_end'
+  csv = true
+[]
@@ -11,6 +11,7 @@
 
 #include "Kernel.h"
 #include "RichardsVarNames.h"
+#include "RichardsPhaseCube.h"
 
 // Forward Declarations
 class RichardsFlux;
@@ -61,13 +62,13 @@ protected:
   const MaterialProperty<std::vector<std::vector<RealTensorValue> > > &_dflux_dgradv;
 
   /// d^2(Richards flux_i)/d(variable_j)/d(variable_k), here flux_i is the i_th flux, which is itself a RealVectorValue
-  const MaterialProperty<std::vector<std::vector<std::vector<RealVectorValue> > > > &_d2flux_dvdv;
+  const MaterialProperty<RichardsPhaseCube<RealVectorValue> > &_d2flux_dvdv;
 
   /// d^2(Richards flux_i)/d(grad(variable_j))/d(variable_k), here flux_i is the i_th flux, which is itself a RealVectorValue
-  const MaterialProperty<std::vector<std::vector<std::vector<RealTensorValue> > > > &_d2flux_dgradvdv;
+  const MaterialProperty<RichardsPhaseCube<RealTensorValue> > &_d2flux_dgradvdv;
 
   /// d^2(Richards flux_i)/d(variable_j)/d(grad(variable_k)), here flux_i is the i_th flux, which is itself a RealVectorValue
-  const MaterialProperty<std::vector<std::vector<std::vector<RealTensorValue> > > > &_d2flux_dvdgradv;
+  const MaterialProperty<RichardsPhaseCube<RealTensorValue> > &_d2flux_dvdgradv;
 
 
 
@@ -144,6 +144,12 @@ protected:
    */
   std::vector<std::vector<Real> > _dmobility_dv;
 
+  /// d(seff)/d(P_ph) at a node, used in prepareNodalValues
+  std::vector<Real> _dseff_dp;
+
+  /// derivatives of the total mass out and total flux in, used in upwind
+  std::vector<Real> _dtotal_mass_out, _dtotal_in;
+
   /**
    * Holds the values of pressures at all the nodes of the element
    * Eg:
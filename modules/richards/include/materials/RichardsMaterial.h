@@ -17,6 +17,7 @@
 #include "RichardsSeff.h"
 #include "RichardsSat.h"
 #include "RichardsSUPG.h"
+#include "RichardsPhaseCube.h"
 
 //Forward Declarations
 class RichardsMaterial;
@@ -122,7 +123,7 @@ protected:
   MaterialProperty<std::vector<std::vector<Real> > > & _dpp_dv;
 
   /// d^2(porepressure_i)/d(variable_j)/d(variable_k)
-  MaterialProperty<std::vector<std::vector<std::vector<Real> > > > & _d2pp_dv;
+  MaterialProperty<RichardsPhaseCube<Real> > & _d2pp_dv;
 
 
   /// fluid viscosity (or viscosities in the multiphase case)
@@ -149,7 +150,7 @@ protected:
   MaterialProperty<std::vector<std::vector<Real> > > & _dseff_dv; // d(seff)/dp
 
   /// d^2(Seff_i)/d(variable_j)/d(variable_k)
-  MaterialProperty<std::vector<std::vector<std::vector<Real> > > > & _d2seff_dv;
+  MaterialProperty<RichardsPhaseCube<Real> > & _d2seff_dv;
 
   /// old saturation
   MaterialProperty<std::vector<Real> > & _sat_old;
@@ -198,13 +199,13 @@ protected:
   MaterialProperty<std::vector<std::vector<RealTensorValue> > > & _dflux_dgradv;
 
   /// d^2(Richards flux_i)/d(variable_j)/d(variable_k), here flux_i is the i_th flux, which is itself a RealVectorValue
-  MaterialProperty<std::vector<std::vector<std::vector<RealVectorValue> > > > & _d2flux_dvdv;
+  MaterialProperty<RichardsPhaseCube<RealVectorValue> > & _d2flux_dvdv;
 
   /// d^2(Richards flux_i)/d(grad(variable_j))/d(variable_k), here flux_i is the i_th flux, which is itself a RealVectorValue
-  MaterialProperty<std::vector<std::vector<std::vector<RealTensorValue> > > > & _d2flux_dgradvdv;
+  MaterialProperty<RichardsPhaseCube<RealTensorValue> > & _d2flux_dgradvdv;
 
   /// d^2(Richards flux_i)/d(variable_j)/d(grad(variable_k)), here flux_i is the i_th flux, which is itself a RealVectorValue.  We should have _d2flux_dvdgradv[i][j][k] = _d2flux_dgradvdv[i][k][j], but i think it is more clear having both, and hopefully not a blowout on memory/CPU.
-  MaterialProperty<std::vector<std::vector<std::vector<RealTensorValue> > > > & _d2flux_dvdgradv;
+  MaterialProperty<RichardsPhaseCube<RealTensorValue> > & _d2flux_dvdgradv;
 
 
 
@@ -214,10 +215,13 @@ protected:
   MaterialProperty<std::vector<std::vector<RealVectorValue> > > & _dtauvel_SUPG_dp; // d (_tauvel_SUPG_i)/d(variable_j)
 
   /// d^2(density)/dp_j/dP_k - used in various derivative calculations
-  std::vector<std::vector<std::vector<Real> > > _d2density;
+  RichardsPhaseCube<Real> _d2density;
 
   /// d^2(relperm_i)/dP_j/dP_k - used in various derivative calculations
-  std::vector<std::vector<std::vector<Real> > > _d2rel_perm_dv;
+  RichardsPhaseCube<Real> _d2rel_perm_dv;
+
+  /// scratch space for RichardsSeff::d2seff, which is then copied into _d2seff_dv
+  std::vector<std::vector<Real> > _d2seff_scratch;
 
 
 
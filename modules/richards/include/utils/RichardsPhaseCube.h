@@ -0,0 +1,99 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+
+#ifndef RICHARDSPHASECUBE_H
+#define RICHARDSPHASECUBE_H
+
+#include "DataIO.h"
+
+#include <vector>
+
+/**
+ * A num_p x num_p x num_p array stored contiguously.
+ * This is used for second derivatives such as
+ * d^2(quantity_i)/d(variable_j)/d(variable_k), which would
+ * otherwise be held in a vector of vectors of vectors, requiring
+ * 1 + num_p + num_p^2 separate allocations per quadpoint.
+ * The number of phases is fixed at setup, so after the first
+ * resize no further allocation occurs.
+ */
+template<typename T>
+class RichardsPhaseCube
+{
+public:
+  RichardsPhaseCube() :
+      _n(0)
+  {
+  }
+
+  /**
+   * Sets the number of phases.  This only allocates
+   * memory if the number of phases changes.
+   * @param n number of phases
+   */
+  void resize(unsigned int n)
+  {
+    if (n == _n)
+      return;
+    _n = n;
+    _vals.resize(n * n * n);
+  }
+
+  /// number of phases
+  unsigned int size() const { return _n; }
+
+  /// sets all entries to value
+  void assign(const T & value)
+  {
+    for (unsigned int i = 0; i < _vals.size(); ++i)
+      _vals[i] = value;
+  }
+
+  /// entry (i, j, k)
+  T & operator()(unsigned int i, unsigned int j, unsigned int k)
+  {
+    return _vals[(i * _n + j) * _n + k];
+  }
+
+  /// entry (i, j, k)
+  const T & operator()(unsigned int i, unsigned int j, unsigned int k) const
+  {
+    return _vals[(i * _n + j) * _n + k];
+  }
+
+  /// number of phases, needed by dataStore and dataLoad
+  unsigned int & n() { return _n; }
+
+  /// all entries, needed by dataStore and dataLoad
+  std::vector<T> & values() { return _vals; }
+
+protected:
+  /// number of phases
+  unsigned int _n;
+
+  /// the entries, with (i, j, k) stored at (i*_n + j)*_n + k
+  std::vector<T> _vals;
+};
+
+template<typename T>
+inline void
+dataStore(std::ostream & stream, RichardsPhaseCube<T> & v, void * context)
+{
+  storeHelper(stream, v.n(), context);
+  storeHelper(stream, v.values(), context);
+}
+
+template<typename T>
+inline void
+dataLoad(std::istream & stream, RichardsPhaseCube<T> & v, void * context)
+{
+  loadHelper(stream, v.n(), context);
+  loadHelper(stream, v.values(), context);
+}
+
+#endif // RICHARDSPHASECUBE_H
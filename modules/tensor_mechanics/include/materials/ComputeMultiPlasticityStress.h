@@ -10,6 +10,8 @@
 #include "ComputeStressBase.h"
 #include "MultiPlasticityDebugger.h"
 
+#include <map>
+
 class ComputeMultiPlasticityStress;
 
 template<>
@@ -132,6 +134,59 @@ protected:
   /// Strain increment that can be rotated by this class, and split into multiple increments (ie, its not const)
   RankTwoTensor _my_strain_increment;
 
+  /// Reuse the result of the previous return-map at a quadrature point if its inputs are unchanged
+  bool _memoize_return_map;
+
+  /**
+   * The inputs and results of the latest return-map at a quadrature point.
+   * The residual, Jacobian and aux computations of a nonlinear iteration
+   * all reinit the material at identical strain increments and old state,
+   * so the stored results are reused rather than recomputed.
+   */
+  struct ReturnMapCacheEntry
+  {
+    ReturnMapCacheEntry() : valid(false) {}
+
+    bool valid;
+
+    // inputs
+    bool first_step;
+    RankTwoTensor strain_increment;
+    RankTwoTensor rotation_increment;
+    RankTwoTensor stress_old;
+    RankTwoTensor plastic_strain_old;
+    RankTwoTensor elastic_strain_old;
+    std::vector<Real> intnl_old;
+    RealVectorValue n_old;
+    RankFourTensor elasticity_tensor;
+
+    // results
+    RankTwoTensor stress;
+    RankTwoTensor plastic_strain;
+    RankTwoTensor elastic_strain;
+    std::vector<Real> intnl;
+    std::vector<Real> yf;
+    Real iter;
+    Real linesearch_needed;
+    Real ld_encountered;
+    Real constraints_added;
+    RealVectorValue n;
+    RankFourTensor jacobian_mult;
+  };
+
+  /// Return-map cache, indexed by element id and then quadrature point
+  std::map<dof_id_type, std::vector<ReturnMapCacheEntry> > _return_map_cache;
+
+  /**
+   * Looks up the cache entry of the current quadrature point
+   * @param entry (output) the entry of the current quadrature point, which is created if necessary
+   * @return true if the entry holds the result of a return-map with the current inputs
+   */
+  bool findCachedReturnMap(ReturnMapCacheEntry * & entry);
+
+  /// Stores the current inputs and results of computeQpStress in entry
+  void cacheReturnMap(ReturnMapCacheEntry & entry);
+
 
 
 
@@ -27,6 +27,11 @@ public:
   FiniteStrainCrystalPlasticity(const InputParameters & parameters);
 
 protected:
+  /**
+   * Invalidates the element crystal rotation cache before the quadrature point loop.
+   */
+  virtual void computeProperties();
+
   /**
    * This function updates the stress at a quadrature point.
    */
@@ -219,6 +224,13 @@ protected:
    */
   void calc_schmid_tensor();
 
+  /**
+   * This function evaluates the crystal rotation, Schmid tensors and rotated
+   * elasticity tensor, reusing the values of the previous quadrature point of
+   * the element when cache_crystal_rotation is set.
+   */
+  void updateCrystalRotation();
+
   /**
    * This function performs the line search update
    */
@@ -299,6 +311,9 @@ protected:
   ///Minimum line search step size
   Real _min_lsrch_step;
 
+  ///Flag to evaluate the crystal rotation once per element instead of once per quadrature point
+  bool _cache_crystal_rotation;
+
   MaterialProperty<RankTwoTensor> & _fp;
   MaterialProperty<RankTwoTensor> & _fp_old;
   MaterialProperty<RankTwoTensor> & _pk2;
@@ -342,6 +357,19 @@ protected:
 
   std::vector<Real> _slip_sys_props;
 
+  ///Crystal rotation cache: valid for the current element once set
+  bool _crystal_rotation_cached;
+  ///Elasticity tensor rotated to the crystal orientation of the current element
+  ElasticityTensorR4 _crysrot_elasticity_tensor;
+
+  ///Scratch storage for the slip system loops; sized once to avoid allocations per iteration
+  std::vector<Real> _gss_prev, _hb;
+  ///Derivative of the plastic deformation gradient inverse w.r.t. slip; depends only on _fp_old_inv and _s0
+  std::vector<RankTwoTensor> _dfpinvdslip;
+  ///_fp_old_inv used to evaluate _dfpinvdslip
+  RankTwoTensor _dfpinvdslip_fp_old_inv;
+  bool _dfpinvdslip_valid;
+
   bool _read_from_slip_sys_file;
 
   bool _err_tol;///Flag to check whether convergence is achieved
@@ -211,6 +211,9 @@ protected:
   /// Dimensionality of rank-four tensor
   static const unsigned int N = LIBMESH_DIM;
 
+  /// Number of index pairs, i.e. the size of C when viewed as an N^2 x N^2 matrix
+  static const unsigned int N2 = N * N;
+
   /// The values of the rank-four tensor
   Real _vals[N][N][N][N];
 
@@ -277,6 +280,11 @@ protected:
    * @param input this is C1111, C1122, C1133, C3333, C2323.
    */
   void fillGeneralFromInputVector(const std::vector<Real> & input);
+
+  /**
+   * c_ij = C_ijkl*b_kl with b and c stored as flat row-major N x N arrays
+   */
+  void contractTwo(const Real * b, Real * c) const;
 };
 
 inline RankFourTensor operator*(Real a, const RankFourTensor & b) { return b * a; }
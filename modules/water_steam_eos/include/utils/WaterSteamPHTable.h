@@ -0,0 +1,144 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef WATERSTEAMPHTABLE_H
+#define WATERSTEAMPHTABLE_H
+
+#include "Moose.h"
+
+#include <string>
+#include <vector>
+
+/**
+ * A tabulated fast path for the IAPWS-97 routine water_steam_prop_ph_ex.
+ *
+ * The outputs of the routine are sampled on a uniform (p, h) grid and interpolated with bicubic
+ * Hermite polynomials.  Every cell is checked against the exact routine on a 5x5 grid of samples.
+ * Cells that miss the tolerance, that contain a sample in another phase than their corners (the
+ * cells crossed by the saturation lines) or whose node derivatives use a failed node or a node in
+ * another phase, and points outside of the grid, are evaluated with the exact routine instead.
+ * A saturation line that enters and leaves a cell between two samples is not detected.
+ */
+class WaterSteamPHTable
+{
+public:
+  /**
+   * Builds the table, or loads it from cache_file if that file holds a table for the same grid
+   * and tolerance.  A newly built table is written to cache_file (when one is given) by the
+   * first processor.
+   * @param tolerance Allowed interpolation error relative to each sampled output.  Below 1e-3
+   *                  times the largest magnitude of an output in the table, the error is
+   *                  relative to that threshold instead.
+   */
+  WaterSteamPHTable(double p_min, double p_max, unsigned int n_p,
+                    double h_min, double h_max, unsigned int n_h,
+                    double tolerance, const std::string & cache_file = "");
+
+  /**
+   * Same arguments and results as Water_Steam_EOS::water_steam_prop_ph_ex.  arg1 and arg2 are
+   * only used when the exact routine is called.
+   */
+  void water_steam_prop_ph_ex(double & p, double & h, double & T, double & Sw,
+                              double & Den, double & Denw, double & Dens, double & hw, double & hs,
+                              double & dDendh, double & dDendp, double & dhwdh, double & dhsdh,
+                              double & dTdh, double & dswdh, int & ierror,
+                              double & dhwdp, double & dhsdp, double & dTdp,
+                              double & arg1, double & arg2) const;
+
+  /**
+   * The fraction of the cells that are interpolated rather than evaluated exactly
+   */
+  double interpolatedFraction() const;
+
+protected:
+  /// The outputs of water_steam_prop_ph_ex that are tabulated, in argument order
+  enum Field
+  {
+    TEMPERATURE,
+    SATURATION,
+    DENSITY,
+    DENSITY_WATER,
+    DENSITY_STEAM,
+    ENTHALPY_WATER,
+    ENTHALPY_STEAM,
+    DDENSITY_DH,
+    DDENSITY_DP,
+    DHW_DH,
+    DHS_DH,
+    DT_DH,
+    DSW_DH,
+    DHW_DP,
+    DHS_DP,
+    DT_DP,
+    N_FIELDS
+  };
+
+  /**
+   * Evaluates the exact routine at (p, h) and stores its outputs in values (size N_FIELDS)
+   */
+  static void exactValues(double p, double h, std::vector<double> & values, int & ierror);
+
+  /**
+   * Samples the exact routine and marks the cells that cannot be interpolated
+   */
+  void build();
+
+  /**
+   * The phase of the outputs of the exact routine: 0 for water, 1 for two phases, 2 for steam
+   */
+  static int phase(const std::vector<double> & values);
+
+  /**
+   * Interpolates the given field in cell (i, j) at the local coordinates (t, u) in [0, 1]
+   */
+  double interpolate(unsigned int field, unsigned int i, unsigned int j, double t, double u) const;
+
+  /**
+   * Finds the cell containing (p, h) and the local coordinates within it
+   * @return false if the point is outside of the table
+   */
+  bool locate(double p, double h, unsigned int & i, unsigned int & j, double & t, double & u) const;
+
+  /// Index of the value (k = 0), p derivative (1), h derivative (2) or cross derivative (3) of a field at node (i, j)
+  unsigned int index(unsigned int i, unsigned int j, unsigned int field, unsigned int k) const
+  {
+    return ((i * _n_h + j) * N_FIELDS + field) * 4 + k;
+  }
+
+  /**
+   * Reads the table from a file written by save()
+   * @return false if the file does not exist or holds a different table
+   */
+  bool load(const std::string & file_name);
+
+  /**
+   * Writes the table to a binary file from the first processor
+   */
+  void save(const std::string & file_name) const;
+
+  /// The table bounds and the number of nodes in each direction
+  const double _p_min;
+  const double _p_max;
+  const unsigned int _n_p;
+  const double _h_min;
+  const double _h_max;
+  const unsigned int _n_h;
+
+  /// The grid spacings
+  const double _dp;
+  const double _dh;
+
+  /// Allowed interpolation error relative to each sampled value (see the constructor)
+  const double _tolerance;
+
+  /// Values and derivatives of every field at every node, see index()
+  std::vector<double> _data;
+
+  /// Nonzero for the cells that are evaluated with the exact routine, ordered like the nodes
+  std::vector<char> _exact_cells;
+};
+
+#endif //WATERSTEAMPHTABLE_H
@@ -0,0 +1,40 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef UNNEEDEDMATERIAL_H
+#define UNNEEDEDMATERIAL_H
+
+#include "Material.h"
+
+class UnneededMaterial;
+
+template<>
+InputParameters validParams<UnneededMaterial>();
+
+/**
+ * Declares a property and errors out if it is ever computed. Used to check that
+ * materials whose properties are not consumed are skipped.
+ */
+class UnneededMaterial : public Material
+{
+public:
+  UnneededMaterial(const InputParameters & parameters);
+
+protected:
+  virtual void computeQpProperties();
+
+  MaterialProperty<Real> & _prop;
+};
+
+#endif //UNNEEDEDMATERIAL_H
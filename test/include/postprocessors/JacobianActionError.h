@@ -0,0 +1,58 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef JACOBIANACTIONERROR_H
+#define JACOBIANACTIONERROR_H
+
+#include "GeneralPostprocessor.h"
+
+class JacobianActionError;
+
+template<>
+InputParameters validParams<JacobianActionError>();
+
+/**
+ * Applies the matrix-free Jacobian action of solve_type = MATRIX_FREE to a random
+ * vector and returns its relative difference to a reference J x at the current
+ * solution.  The reference is either the product with the assembled matrix, which
+ * must then hold the full Jacobian, or a central difference of the residual, which
+ * requires exact Jacobians.
+ */
+class JacobianActionError : public GeneralPostprocessor
+{
+public:
+  JacobianActionError(const InputParameters & parameters);
+
+  virtual void initialize();
+
+  virtual void execute();
+
+  /**
+   * Return the relative difference between the action and the reference
+   */
+  virtual Real getValue();
+
+protected:
+  /// How the reference J x is computed
+  MooseEnum _reference;
+
+  /// The step of the central difference
+  Real _epsilon;
+
+  /// The relative difference
+  Real _error;
+};
+
+#endif // JACOBIANACTIONERROR_H
@@ -0,0 +1,58 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef TESTGHOSTEDSOLUTION_H
+#define TESTGHOSTEDSOLUTION_H
+
+#include "GeneralPostprocessor.h"
+
+class TestGhostedSolution;
+class MooseVariable;
+
+template<>
+InputParameters validParams<TestGhostedSolution>();
+
+/**
+ * A postprocessor for testing that a node requested with addGhostedNode() can be
+ * read from the ghosted solution vector on every processor
+ */
+class TestGhostedSolution : public GeneralPostprocessor
+{
+public:
+  TestGhostedSolution(const InputParameters & parameters);
+
+  virtual void initialize();
+
+  /**
+   * Read the value at the node - verify the same answer on all processors
+   */
+  virtual void execute();
+
+  /**
+   * Return the value at the node.
+   */
+  virtual Real getValue();
+
+protected:
+  /// The variable being read
+  MooseVariable & _var;
+
+  /// The ID of the node being read
+  dof_id_type _node_id;
+
+  /// The value read from the ghosted solution
+  Real _value;
+};
+
+#endif /* TESTGHOSTEDSOLUTION_H */
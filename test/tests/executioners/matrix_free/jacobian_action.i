@@ -0,0 +1,90 @@
+# Compares the matrix-free Jacobian action with a reference J x at the converged
+# solution of a nonlinear coupled problem.  By default the preconditioning matrix
+# holds the full Jacobian and is the reference.  With a block diagonal
+# preconditioner and p = 2 (where every Jacobian is exact) the reference is a
+# central difference of the residual, which checks the couplings that only the
+# action has, including the off-diagonal NodalBC entries.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 5
+  ny = 5
+[]
+
+[Variables]
+  [./u]
+  [../]
+  [./v]
+  [../]
+[]
+
+[Kernels]
+  [./diff_u]
+    type = PHarmonic
+    variable = u
+    p = 3
+  [../]
+  [./force_u]
+    type = CoupledForce
+    variable = u
+    v = v
+  [../]
+  [./diff_v]
+    type = Diffusion
+    variable = v
+  [../]
+  [./grad_v]
+    type = CoupledKernelGradTest
+    variable = v
+    var2 = u
+    vel = '1 0.5'
+  [../]
+[]
+
+[BCs]
+  [./left_u]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 1
+  [../]
+  [./left_v]
+    type = DirichletBC
+    variable = v
+    boundary = left
+    value = 2
+  [../]
+  # u + u^2 + v^2 = 9
+  [./right_u]
+    type = CoupledDirichletBC
+    variable = u
+    boundary = right
+    value = 9
+    v = v
+  [../]
+[]
+
+[Postprocessors]
+  [./action_error]
+    type = JacobianActionError
+  [../]
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = MATRIX_FREE
+  nl_rel_tol = 1e-10
+  l_tol = 1e-12
+[]
+
+[Outputs]
+  execute_on = 'timestep_end'
+  csv = true
+[]
@@ -0,0 +1,80 @@
+# Two coupled diffusion equations solved with the matrix-free Jacobian action:
+#   -u'' = 0,  u(0) = 0, u(1) = 1   ->  u = x
+#   -v'' = u,  v(0) = v(1) = 0      ->  v = (x - x^3) / 6
+# Linear elements are nodally exact in 1D, so v(0.5) = 0.0625.
+# The preconditioning matrix only has the diagonal blocks, the coupling
+# comes from the action alone.
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+  [./v]
+  [../]
+[]
+
+[Kernels]
+  [./diff_u]
+    type = Diffusion
+    variable = u
+  [../]
+  [./diff_v]
+    type = Diffusion
+    variable = v
+  [../]
+  [./force_v]
+    type = CoupledForce
+    variable = v
+    v = u
+  [../]
+[]
+
+[BCs]
+  [./u_left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./u_right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+  [./v]
+    type = DirichletBC
+    variable = v
+    boundary = 'left right'
+    value = 0
+  [../]
+[]
+
+[Postprocessors]
+  [./u_mid]
+    type = PointValue
+    variable = u
+    point = '0.5 0 0'
+  [../]
+  [./v_mid]
+    type = PointValue
+    variable = v
+    point = '0.5 0 0'
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = MATRIX_FREE
+  nl_rel_tol = 1e-12
+  l_tol = 1e-12
+[]
+
+[Outputs]
+  execute_on = 'timestep_end'
+  csv = true
+[]
@@ -0,0 +1,55 @@
+# A PiecewiseLinear function along x evaluated for all of the qps of an element at once
+# (Function::values()).  The kink at x = 0.5 is on an element edge, so the integral of
+# the property is exact: 0.25 + 1 = 1.25
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 4
+  ny = 4
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Functions]
+  [./conductivity]
+    type = PiecewiseLinear
+    axis = 0
+    x = '0 0.5 1'
+    y = '0 1 3'
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[Materials]
+  [./gfm]
+    type = GenericFunctionMaterial
+    block = 0
+    prop_names = conductivity
+    prop_values = conductivity
+  [../]
+[]
+
+[Postprocessors]
+  [./conductivity_integral]
+    type = ElementIntegralMaterialProperty
+    mat_prop = conductivity
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  execute_on = 'timestep_end'
+  csv = true
+[]
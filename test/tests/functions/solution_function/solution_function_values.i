@@ -0,0 +1,70 @@
+# A SolutionFunction evaluated for all of the qps of an element at once
+# (SolutionUserObject::pointValues() through GenericFunctionMaterial).  The solution
+# is u = x, so the integral of the property over [0,0.5]x[-0.5,0.5]^2 is 0.125
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  xmin = 0
+  xmax = 0.5
+  nx = 2
+  ymin = -0.5
+  ymax = 0.5
+  ny = 3
+  zmin = -0.5
+  zmax = 0.5
+  nz = 3
+[]
+
+[UserObjects]
+  [./solution_uo]
+    type = SolutionUserObject
+    mesh = cube_with_u_equals_x.e
+    timestep = 1
+    system_variables = u
+  [../]
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Functions]
+  [./solution_fcn]
+    type = SolutionFunction
+    from_variable = u
+    solution = solution_uo
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[Materials]
+  [./gfm]
+    type = GenericFunctionMaterial
+    block = 0
+    prop_names = u_from_file
+    prop_values = solution_fcn
+  [../]
+[]
+
+[Postprocessors]
+  [./u_from_file_integral]
+    type = ElementIntegralMaterialProperty
+    mat_prop = u_from_file
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  execute_on = 'timestep_end'
+  csv = true
+[]
@@ -0,0 +1,84 @@
+# Only the materials supplying properties consumed by the active kernels and
+# postprocessors (and the materials those depend on) are computed. The
+# 'unneeded' material errors out if it is ever evaluated.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 4
+  ny = 4
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = DiffMKernel
+    variable = u
+    mat_prop = sum
+    offset = 0
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Materials]
+  [./constants]
+    type = GenericConstantMaterial
+    block = 0
+    prop_names = 'a b'
+    prop_values = '1 2'
+  [../]
+  [./sum]
+    type = SumMaterial
+    block = 0
+    sum_prop_name = sum
+    mp1 = a
+    mp2 = b
+    val1 = 1
+    val2 = 2
+  [../]
+  [./unneeded]
+    type = UnneededMaterial
+    block = 0
+    prop_name = unneeded
+  [../]
+[]
+
+[Postprocessors]
+  [./u_mid]
+    type = PointValue
+    variable = u
+    point = '0.5 0.5 0'
+  [../]
+  [./sum_integral]
+    type = ElementIntegralMaterialProperty
+    mat_prop = sum
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = PJFNK
+  nl_rel_tol = 1e-12
+[]
+
+[Outputs]
+  execute_on = 'timestep_end'
+  csv = true
+[]
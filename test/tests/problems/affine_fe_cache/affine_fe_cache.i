@@ -0,0 +1,74 @@
+# All TRI3 elements are affine, so after the first element the volume shape
+# functions come from the reference data.  u = x is reproduced exactly, which
+# needs correct gradients, q_points and JxW on every element.  The tests file
+# runs the same problem on HEX8 and TET4 meshes against the same values.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 4
+  ny = 4
+  elem_type = TRI3
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Functions]
+  [./x]
+    type = ParsedFunction
+    value = x
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./h1_semi_error]
+    type = ElementH1SemiError
+    variable = u
+    function = x
+  [../]
+  [./u_integral]
+    type = ElementIntegralVariablePostprocessor
+    variable = u
+  [../]
+[]
+
+[Problem]
+  type = FEProblem
+  affine_fe_cache = true
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+[]
+
+[Outputs]
+  execute_on = 'timestep_end'
+  csv = true
+[]
@@ -0,0 +1,95 @@
+# The elemental AuxKernel and the ElementUserObject executed on 'linear' are
+# not consumed by the residual, so both are computed in the residual element
+# loop. u = x and the element averages of x integrate to 0.5 as well, their
+# value on the right elements is 0.875.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 4
+  ny = 4
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./x_elem]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[Functions]
+  [./x]
+    type = ParsedFunction
+    value = x
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[AuxKernels]
+  [./x_elem]
+    type = FunctionAux
+    variable = x_elem
+    function = x
+    execute_on = linear
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./u_integral]
+    type = ElementIntegralVariablePostprocessor
+    variable = u
+    execute_on = linear
+  [../]
+  [./x_elem_integral]
+    type = ElementIntegralVariablePostprocessor
+    variable = x_elem
+    execute_on = timestep_end
+  [../]
+  [./x_elem_right]
+    type = SideAverageValue
+    variable = x_elem
+    boundary = right
+    execute_on = timestep_end
+  [../]
+[]
+
+[Problem]
+  type = FEProblem
+  fuse_residual_loops = true
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = PJFNK
+  nl_rel_tol = 1e-12
+[]
+
+[Outputs]
+  execute_on = 'timestep_end'
+  csv = true
+[]
@@ -0,0 +1,87 @@
+# The Jacobian is assembled in the element loop of the residual the solver
+# asks for and reused by the Jacobian evaluation at the same solution, so no
+# separate Jacobian evaluation is made.
+# v = 1 and -u'' = v with u = 0 on both ends, so u = x (1 - x) / 2 and a
+# single Newton step with an exact linear solve converges.
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+  [./v]
+  [../]
+[]
+
+[Kernels]
+  [./diff_u]
+    type = Diffusion
+    variable = u
+  [../]
+  [./force_u]
+    type = CoupledForce
+    variable = u
+    v = v
+  [../]
+  [./diff_v]
+    type = Diffusion
+    variable = v
+  [../]
+[]
+
+[BCs]
+  [./u]
+    type = DirichletBC
+    variable = u
+    boundary = 'left right'
+    value = 0
+  [../]
+  [./v]
+    type = DirichletBC
+    variable = v
+    boundary = 'left right'
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./jac_evals]
+    type = NumJacobianEvaluations
+  [../]
+  [./nl_its]
+    type = NumNonlinearIterations
+  [../]
+  [./u_integral]
+    type = ElementIntegralVariablePostprocessor
+    variable = u
+  [../]
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Problem]
+  type = FEProblem
+  residual_and_jacobian_together = true
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+  line_search = none
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  nl_rel_tol = 1e-10
+[]
+
+[Outputs]
+  execute_on = 'timestep_end'
+  csv = true
+[]
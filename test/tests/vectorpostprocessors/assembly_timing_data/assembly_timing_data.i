@@ -0,0 +1,80 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[MeshModifiers]
+  [./subdomain]
+    type = SubdomainBoundingBox
+    bottom_left = '0 0 0'
+    top_right = '0.3 1 0'
+    block_id = 1
+  [../]
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[VectorPostprocessors]
+  [./threads]
+    type = AssemblyTimingData
+    data = threads
+  [../]
+  [./subdomains]
+    type = AssemblyTimingData
+    data = subdomains
+  [../]
+  [./jacobian_threads]
+    type = AssemblyTimingData
+    loop = jacobian
+    data = threads
+  [../]
+  # Every loop visits each element once on exactly one thread of one processor,
+  # so these have to match the subdomain sizes (30 and 70 elements)
+  [./residual_elements]
+    type = AssemblyTimingData
+    data = elements
+  [../]
+  [./jacobian_elements]
+    type = AssemblyTimingData
+    loop = jacobian
+    data = elements
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+  assembly_timing = true
+[]
+
+[Outputs]
+  execute_on = 'timestep_end'
+  csv = true
+[]
@@ -0,0 +1,64 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef KDTREEELEMENTLOCATORTEST_H
+#define KDTREEELEMENTLOCATORTEST_H
+
+//CPPUnit includes
+#include "cppunit/extensions/HelperMacros.h"
+
+// Moose includes
+#include "MooseTypes.h"
+
+// libMesh includes
+#include "libmesh/point.h"
+
+// Forward declarations
+class MooseApp;
+
+namespace libMesh
+{
+class MeshBase;
+class Elem;
+}
+
+class KDTreeElementLocatorTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE( KDTreeElementLocatorTest );
+
+  CPPUNIT_TEST( gradedMesh );
+  CPPUNIT_TEST( outsidePoints );
+  CPPUNIT_TEST( hint );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void setUp();
+  void tearDown();
+
+  void gradedMesh();
+  void outsidePoints();
+  void hint();
+
+private:
+  /// The element with the lowest id containing the point, found by looping over the whole mesh
+  const Elem * bruteForceLocate(const MeshBase & mesh, const Point & p);
+
+  MooseApp * _app;
+  MeshBase * _mesh;
+  std::vector<Point> _queries;
+};
+
+#endif  // KDTREEELEMENTLOCATORTEST_H
@@ -0,0 +1,49 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef KDTREETEST_H
+#define KDTREETEST_H
+
+//CPPUnit includes
+#include "cppunit/extensions/HelperMacros.h"
+
+// Moose includes
+#include "MooseTypes.h"
+
+// libMesh includes
+#include "libmesh/point.h"
+
+class KDTreeTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE( KDTreeTest );
+
+  CPPUNIT_TEST( neighborSearch );
+  CPPUNIT_TEST( radiusSearch );
+  CPPUNIT_TEST( emptyTree );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void setUp();
+
+  void neighborSearch();
+  void radiusSearch();
+  void emptyTree();
+
+private:
+  std::vector<Point> _points;
+  std::vector<Point> _queries;
+};
+
+#endif  // KDTREETEST_H
@@ -24,6 +24,9 @@ class LinearInterpolationTest : public CppUnit::TestFixture
 
   CPPUNIT_TEST( constructor );
   CPPUNIT_TEST( sample );
+  CPPUNIT_TEST( sampleUniform );
+  CPPUNIT_TEST( sampleVector );
+  CPPUNIT_TEST( sampleNaN );
   CPPUNIT_TEST( getSampleSize );
 
   CPPUNIT_TEST_SUITE_END();
@@ -34,6 +37,9 @@ public:
 
   void constructor();
   void sample();
+  void sampleUniform();
+  void sampleVector();
+  void sampleNaN();
   void getSampleSize();
 
 private:
@@ -20,6 +20,7 @@
 
 // Moose includes
 #include "RankFourTensor.h"
+#include "RankTwoTensor.h"
 
 class RankFourTensorTest : public CppUnit::TestFixture
 {
@@ -31,6 +32,9 @@ class RankFourTensorTest : public CppUnit::TestFixture
   CPPUNIT_TEST( matrixInversionTest3 );
   CPPUNIT_TEST( invSymmTest1 );
   CPPUNIT_TEST( invSymmTest2 );
+  CPPUNIT_TEST( invSymmReferenceTest );
+  CPPUNIT_TEST( contractRankTwoTest );
+  CPPUNIT_TEST( contractRankFourTest );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -43,9 +47,20 @@ public:
   void matrixInversionTest3();
   void invSymmTest1();
   void invSymmTest2();
+  void invSymmReferenceTest();
+  void contractRankTwoTest();
+  void contractRankFourTest();
 
  private:
   RankFourTensor _iSymmetric;
+
+  /// A symmetric, positive definite tensor (C_ijkl = C_jikl = C_ijlk = C_klij)
+  RankFourTensor _a;
+
+  /// A general tensor
+  RankFourTensor _b;
+
+  RankTwoTensor _strain;
 };
 
 #endif  // RANKFOURTENSORTEST_H
@@ -0,0 +1,68 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef WATERSTEAMPHTABLETEST_H
+#define WATERSTEAMPHTABLETEST_H
+
+//CPPUnit includes
+#include "cppunit/extensions/HelperMacros.h"
+
+#include <vector>
+
+// Forward declarations
+class WaterSteamPHTable;
+
+class WaterSteamPHTableTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE( WaterSteamPHTableTest );
+
+  CPPUNIT_TEST( awayFromSaturation );
+  CPPUNIT_TEST( nearSaturation );
+  CPPUNIT_TEST( cacheFile );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void setUp();
+  void tearDown();
+
+  void awayFromSaturation();
+  void nearSaturation();
+  void cacheFile();
+
+private:
+  /// Outputs of the exact routine, in argument order
+  static void exactValues(double p, double h, std::vector<double> & values, int & ierror);
+
+  /// Outputs of the table, in argument order
+  static void tableValues(const WaterSteamPHTable & table, double p, double h, std::vector<double> & values, int & ierror);
+
+  /// Compares the table with the exact routine at (p, h)
+  void check(double p, double h);
+
+  WaterSteamPHTable * _table;
+
+  /// Smallest magnitude of each output the error is taken relative to
+  std::vector<double> _floors;
+
+  static const double _p_min;
+  static const double _p_max;
+  static const unsigned int _n_p;
+  static const double _h_min;
+  static const double _h_max;
+  static const unsigned int _n_h;
+  static const double _tol;
+};
+
+#endif  // WATERSTEAMPHTABLETEST_H